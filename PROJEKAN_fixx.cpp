@@ -1,6 +1,7 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <cctype>
 #include <vector>
 #include <map>
 #include <queue>
@@ -8,6 +9,26 @@
 #include <string>
 #include <limits>
 #include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <cstring>
+#include <chrono>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define PROJEKAN_SHARD // Shard routing memakai fork dan socket lokal (POSIX)
+#endif
+// std::thread tidak tersedia di MinGW lama dengan model thread win32; tanpa itu pencarian paralel berjalan berurutan
+#if !defined(_WIN32) || defined(_MSC_VER) || defined(_GLIBCXX_HAS_GTHREADS)
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#define PROJEKAN_THREAD
+#endif
 
 using namespace std;
 
@@ -26,6 +47,10 @@ struct AngkutanUmum {
     string jamMulaiOperasional; // Jam mulai operasional
     string jamTutupOperasional; // Jam tutup operasional
     int waktuTempuh; // Waktu tempuh dalam menit
+    int frekuensi = 0; // Interval keberangkatan dalam menit (0 = tidak berkala, bisa berangkat kapan saja)
+    string hariOperasi; // Pola hari operasi Senin-Minggu, mis. "1111100" (kosong = setiap hari)
+    int keterlambatan = 0; // Overlay feed gangguan: tambahan waktu tempuh dalam menit (tidak disimpan ke file)
+    bool dibatalkan = false; // Overlay feed gangguan: layanan dibatalkan (tidak disimpan ke file)
 };
 
 // Struct untuk representasi Kota (dianggap sebagai Node)
@@ -39,6 +64,160 @@ struct Graph {
     map<string, vector<pair<string, AngkutanUmum>>> adjList; // key: lokasi, value: pasangan (lokasi tujuan, angkutan umum)
 };
 
+// Struct untuk satu event dari feed gangguan layanan (keterlambatan, pembatalan, atau pemulihan)
+struct GangguanLayanan {
+    string jenis; // TERLAMBAT, BATAL, atau PULIH
+    string nama; // Nama angkutan umum
+    string kotaAsal;
+    string kotaTujuan;
+    string jamMulaiOperasional; // Bersama nama, asal, dan tujuan mengidentifikasi layanan
+    int menit = 0; // Besar keterlambatan untuk event TERLAMBAT
+};
+
+// Struct untuk pohon jalur terpendek dari satu kota asal yang disimpan agar bisa diperbaiki saat ada gangguan
+struct PohonRute {
+    string asal;
+    string waktu;
+    int hari;
+    map<string, int> dist; // Jarak dari kota asal ke setiap kota
+    map<string, string> prev; // Kota sebelumnya pada jalur terpendek
+    long perubahanDiterapkan = 0; // Nomor urut perubahan edge pertama yang belum diterapkan ke pohon ini
+    long terakhirDipakai = 0; // Nilai jamPakai cache saat pohon terakhir dipakai (untuk eviction LRU)
+};
+
+// Struct untuk cache pohon rute; satu pohon melayani semua kota tujuan dari asal, waktu, dan hari yang sama.
+// Feed gangguan hanya mencatat edge yang berubah; setiap pohon diperbaiki saat dipakai, sekaligus untuk semua
+// perubahan yang belum diterapkan kepadanya.
+struct CacheRute {
+    map<string, PohonRute> pohon; // Kunci: asal|waktu|hari
+    map<string, vector<string>> pendahulu; // Kota -> kota yang memiliki edge ke kota tersebut (untuk perbaikan pohon)
+    vector<pair<string, string>> perubahan; // Edge (asal, tujuan) yang bobotnya berubah, urut sesuai kedatangan event
+    long perubahanAwal = 0; // Nomor urut perubahan[0]
+    long jamPakai = 0; // Bertambah setiap pohon dipakai
+};
+
+// Struct untuk statistik pemrosesan feed gangguan
+struct StatistikFeed {
+    long jumlahEvent = 0;
+    long diterapkan = 0;
+    long tidakDikenal = 0; // Baris tidak valid atau layanan tidak ditemukan
+    long pohonDiperbaiki = 0;
+    double totalMikrodetik = 0; // Waktu menerapkan event ke overlay dan mencatat edge yang berubah
+    double perbaikanMikrodetik = 0; // Waktu perbaikan pohon (terpisah dari total karena perbaikan ditunda)
+};
+
+// Struct untuk representasi edge dalam bentuk integer ringkas (tanpa string), dipakai oleh penyimpanan graf di disk
+struct EdgeKompak {
+    int tujuan; // ID kota tujuan
+    int waktuTempuh; // Waktu tempuh dalam menit
+    int mulai; // Jam mulai operasional dalam menit sejak 00:00 (-1 = tidak valid)
+    int tutup; // Jam tutup operasional dalam menit sejak 00:00 (-1 = tidak valid)
+    int frekuensi; // Interval keberangkatan dalam menit (0 = tidak berkala)
+    int hariMask; // Bit 0 = Senin ... bit 6 = Minggu
+    int angkutan; // Indeks nama angkutan umum
+};
+
+// Struct untuk representasi graf kompak (CSR): edge kota ke-i berada di indeks offset[i] .. offset[i + 1].
+// Edge disimpan sebagai struct-of-arrays agar beberapa edge sekaligus dapat diproses dengan SIMD.
+struct GraphKompak {
+    vector<string> namaKota; // ID kota -> nama kota
+    map<string, int> idKota; // Nama kota -> ID kota
+    vector<string> namaAngkutan; // Indeks -> nama angkutan umum
+    vector<int> offset; // Indeks edge pertama setiap kota (ukuran = jumlah kota + 1)
+    vector<int> tujuan; // ID kota tujuan setiap edge
+    vector<int> waktuTempuh; // Waktu tempuh setiap edge dalam menit
+    vector<int> mulai; // Jam mulai operasional dalam menit (-1 = tidak valid)
+    vector<int> tutup; // Jam tutup operasional dalam menit (-1 = tidak valid)
+    vector<int> frekuensi; // Interval keberangkatan dalam menit (0 = tidak berkala)
+    vector<int> hariMask; // Bit 0 = Senin ... bit 6 = Minggu
+    vector<int> angkutan; // Indeks nama angkutan umum
+    bool kedaluwarsa = true; // true jika belum dibangun atau graf berubah setelahnya
+};
+
+// Struct untuk lokasi daftar edge sebuah kota di dalam file halaman
+struct DirektoriKota {
+    int edgeAwal; // Indeks edge pertama milik kota ini
+    int jumlahEdge; // Banyaknya edge keluar
+};
+
+// Struct untuk statistik buffer pool per query
+struct StatistikHalaman {
+    long akses = 0; // Jumlah permintaan halaman (sekali per halaman setiap kali sebuah kota diekspansi)
+    long hit = 0; // Permintaan yang sudah ada di buffer pool
+    long pageFault = 0; // Permintaan yang harus dibaca dari disk
+    long prefetch = 0; // Halaman yang dibaca lebih awal untuk tetangga; juga pembacaan disk, di luar hitungan akses
+};
+
+// Struct untuk penyimpanan graf berhalaman di disk dengan buffer pool (eviction CLOCK).
+// Hanya nama dan direktori kota yang berada di memori; daftar edge dibaca per halaman saat dibutuhkan.
+struct PenyimpananGrafBerhalaman {
+    ifstream file;
+    vector<string> namaKota; // ID kota -> nama kota (urutan Cuthill-McKee)
+    map<string, int> idKota; // Nama kota -> ID kota
+    vector<string> namaAngkutan; // Indeks -> nama angkutan umum
+    vector<DirektoriKota> direktori; // Lokasi edge untuk setiap kota
+    unsigned long long sidikJari = 0; // Sidik jari data graf saat file dibangun (lihat sidikJariHalaman)
+    bool kedaluwarsa = true; // true jika belum dibuka atau graf berubah setelahnya
+    long posisiHalamanPertama = 0; // Offset byte halaman pertama di file
+    int jumlahHalaman = 0;
+
+    vector<vector<EdgeKompak>> frame; // Isi setiap frame buffer pool
+    vector<int> halamanDiFrame; // Halaman yang menempati setiap frame (-1 = kosong)
+    vector<bool> bitReferensi; // Bit referensi untuk algoritma CLOCK
+    vector<int> frameDariHalaman; // Halaman -> frame (-1 = tidak ada di buffer pool)
+    size_t jarumClock = 0;
+    StatistikHalaman statistik;
+};
+
+// Struct untuk satu rentang menit keberangkatan yang memiliki pola rute yang sama
+struct IntervalPola {
+    int menitMulai; // Berlaku dari menit ini sampai menitMulai interval berikutnya
+    int polaTercepat; // Indeks pola rute tercepat (-1 = tidak ada rute)
+    int polaAlternatif; // Indeks pola rute alternatif (-1 = tidak ada)
+};
+
+// Struct untuk indeks pola rute antar kota terdaftar. Untuk setiap pasangan kota dan kelompok hari, rute tercepat dan
+// alternatif untuk setiap menit 00:00-23:59 dipadatkan menjadi rentang menit dengan pola yang sama.
+struct IndeksPolaRute {
+    bool kedaluwarsa = true; // true jika belum dibangun/dimuat atau graf berubah setelahnya
+    unsigned long long sidikJari = 0; // Sidik jari graf dan daftar kota terdaftar saat indeks dibangun
+    vector<string> namaKota; // ID kota -> nama kota; ID 0 .. jumlahTerdaftar - 1 adalah kota terdaftar
+    map<string, int> idKota;
+    int jumlahTerdaftar = 0;
+    vector<int> kelompokHari; // Hari 0..7 -> kelompok hari dengan layanan beroperasi yang sama
+    vector<vector<int>> pola; // Pola rute: urutan ID kota
+    vector<vector<IntervalPola>> interval; // [(kelompok * jumlahTerdaftar + asal) * jumlahTerdaftar + tujuan]
+};
+
+#ifdef PROJEKAN_THREAD
+// Struct untuk kumpulan thread pekerja yang dibuat sekali dan dipakai ulang oleh pencarian paralel.
+// Satu batch tugas berjalan pada satu waktu; pemanggil ikut mengerjakan tugas lalu menunggu batch selesai.
+struct KumpulanThread {
+    vector<thread> pekerja;
+    mutex kunci;
+    mutex kunciPemanggil; // Menjaga agar hanya satu batch yang berjalan
+    condition_variable adaBatch; // Dibangunkan saat batch baru tersedia atau kumpulan dihentikan
+    condition_variable batchSelesai;
+    const function<void(size_t)> *tugas = nullptr; // Dipanggil dengan indeks tugas 0 .. jumlahTugas - 1
+    size_t jumlahTugas = 0;
+    size_t tugasBerikutnya = 0;
+    size_t tugasSelesai = 0;
+    long generasi = 0; // Bertambah setiap batch baru
+    bool berhenti = false;
+
+    ~KumpulanThread() {
+        {
+            lock_guard<mutex> lk(kunci);
+            berhenti = true;
+        }
+        adaBatch.notify_all();
+        for (auto &t : pekerja) {
+            t.join();
+        }
+    }
+};
+#endif
+
 // Fungsi untuk menampilkan graf antar kota (adjacency list) yang hanya menampilkan kota terdaftar
 void tampilkanGraf(const Graph &graph, const string &namaFileKota) {
     cout << "\nGraf Antar Kota (Adjacency List):\n";
@@ -50,126 +229,2381 @@ void tampilkanGraf(const Graph &graph, const string &namaFileKota) {
             for (const auto &neighbor : graph.adjList.at(kota)) {
                 cout << "(" << neighbor.first << ", " << neighbor.second.nama << ", " << neighbor.second.waktuTempuh << ") ";
             }
-            cout << endl;
+            cout << endl;
+        }
+    }
+    fileKota.close();
+    cout << endl;
+}
+
+// Fungsi untuk mengubah waktu (HH:MM) menjadi menit sejak 00:00, -1 jika format tidak valid
+// Diurai manual (tanpa stringstream) karena dipanggil untuk setiap edge di dalam Dijkstra
+int waktuKeMenit(const string &waktu) {
+    size_t i = 0;
+    int jam = 0, menit = 0;
+    while (i < waktu.size() && isdigit(static_cast<unsigned char>(waktu[i]))) {
+        jam = jam * 10 + (waktu[i++] - '0');
+    }
+    if (i == 0 || i >= waktu.size() || waktu[i] != ':') {
+        return -1;
+    }
+    size_t awalMenit = ++i;
+    while (i < waktu.size() && isdigit(static_cast<unsigned char>(waktu[i]))) {
+        menit = menit * 10 + (waktu[i++] - '0');
+    }
+    if (i == awalMenit) {
+        return -1;
+    }
+    return jam * 60 + menit;
+}
+
+// Fungsi untuk mengubah menit sejak 00:00 menjadi waktu (HH:MM)
+string menitKeWaktu(int menit) {
+    stringstream ss;
+    ss << (menit / 60 < 10 ? "0" : "") << menit / 60 << ":" << (menit % 60 < 10 ? "0" : "") << menit % 60;
+    return ss.str();
+}
+
+// Fungsi untuk mengecek apakah angkutan umum beroperasi pada hari tertentu (1 = Senin ... 7 = Minggu, 0 = abaikan hari)
+bool isAngkutanUmumBeroperasiPadaHari(const AngkutanUmum &au, int hari) {
+    if (hari < 1 || hari > 7 || au.hariOperasi.empty()) {
+        return true;
+    }
+    return au.hariOperasi.size() >= static_cast<size_t>(hari) && au.hariOperasi[hari - 1] == '1';
+}
+
+// Fungsi untuk menghitung menit keberangkatan berikutnya pada atau setelah menit tertentu.
+// Layanan berkala tidak disimpan per keberangkatan, tetapi dihitung dari jam mulai dan frekuensinya.
+int keberangkatanBerikutnya(const AngkutanUmum &au, int menit) {
+    int mulai = waktuKeMenit(au.jamMulaiOperasional);
+    if (au.frekuensi <= 0 || menit <= mulai) {
+        return max(menit, mulai);
+    }
+    return mulai + (menit - mulai + au.frekuensi - 1) / au.frekuensi * au.frekuensi;
+}
+
+// Fungsi untuk menghitung waktu tunggu (menit) sampai angkutan umum berangkat jika tiba di halte pada menit tertentu
+int waktuTungguAngkutanUmum(const AngkutanUmum &au, int menit) {
+    return keberangkatanBerikutnya(au, menit) - menit;
+}
+
+// Fungsi untuk mengecek ketersediaan angkutan umum bagi penumpang yang tiba pada menit dan hari tertentu.
+// Penumpang yang tiba sebelum jam mulai menunggu keberangkatan pertama, sehingga tiba lebih awal tidak pernah
+// membuat angkutan umum menjadi tidak tersedia (syarat agar Dijkstra berbasis waktu tiba tetap tepat).
+bool isAngkutanUmumAvailable(const AngkutanUmum &au, int menit, int hari = 0) {
+    if (!isAngkutanUmumBeroperasiPadaHari(au, hari)) {
+        return false;
+    }
+
+    int mulai = waktuKeMenit(au.jamMulaiOperasional);
+    int tutup = waktuKeMenit(au.jamTutupOperasional);
+    if (menit < 0 || mulai < 0 || tutup < 0) {
+        return false;
+    }
+
+    // Tersedia selama masih ada keberangkatan sebelum jam tutup
+    return keberangkatanBerikutnya(au, menit) <= tutup;
+}
+
+// Fungsi untuk mengubah satu baris file menjadi data angkutan umum.
+// Format: nama asal tujuan mulai tutup waktuTempuh [frekuensi [hariOperasi]]
+AngkutanUmum bacaBarisAngkutanUmum(const string &line) {
+    stringstream ss(line);
+    AngkutanUmum angkutan;
+    ss >> angkutan.nama >> angkutan.kotaAsal >> angkutan.kotaTujuan >> angkutan.jamMulaiOperasional >> angkutan.jamTutupOperasional >> angkutan.waktuTempuh;
+
+    // Kolom frekuensi dan hari operasi bersifat opsional agar data lama tetap terbaca
+    int frekuensi;
+    if (ss >> frekuensi) {
+        angkutan.frekuensi = max(frekuensi, 0);
+        ss >> angkutan.hariOperasi;
+    }
+    return angkutan;
+}
+
+// Fungsi untuk menampilkan pola hari operasi dalam bentuk nama hari
+string namaHariOperasi(const string &pola) {
+    const string namaHari[] = {"Senin", "Selasa", "Rabu", "Kamis", "Jumat", "Sabtu", "Minggu"};
+    if (pola.empty()) {
+        return "Setiap hari";
+    }
+
+    string hasil;
+    for (size_t i = 0; i < pola.size() && i < 7; ++i) {
+        if (pola[i] == '1') {
+            hasil += (hasil.empty() ? "" : ", ") + namaHari[i];
+        }
+    }
+    return hasil.empty() ? "Tidak beroperasi" : hasil;
+}
+
+// Fungsi untuk memuat data angkutan umum dari file
+void muatDataAngkutanUmum(vector<AngkutanUmum> &angkutanUmum, const string &namaFile) {
+    ifstream file(namaFile);
+    string line;
+
+    while (getline(file, line)) {
+        angkutanUmum.push_back(bacaBarisAngkutanUmum(line));
+    }
+
+    file.close();
+}
+
+// Fungsi untuk menambahkan angkutan umum ke graf
+void tambahAngkutanUmumKeGraf(Graph &graph, const AngkutanUmum &au) {
+    // Tambahkan kota tujuan ke graf jika belum ada
+    if (graph.adjList.find(au.kotaTujuan) == graph.adjList.end()) {
+        graph.adjList[au.kotaTujuan] = {};
+    }
+    // Tambahkan angkutan umum ke kota asal
+    graph.adjList[au.kotaAsal].push_back({au.kotaTujuan, au});
+}
+
+// Fungsi untuk menghitung bobot edge bagi penumpang yang tiba di kota asal edge pada menit tertentu:
+// waktu tunggu + waktu tempuh + keterlambatan dari feed gangguan.
+// Mengembalikan -1 jika angkutan umum tidak tersedia pada menit/hari tersebut atau dibatalkan.
+int bobotAngkutanUmum(const AngkutanUmum &au, int menit, int hari) {
+    if (au.dibatalkan || !isAngkutanUmumAvailable(au, menit, hari)) return -1;
+    return waktuTungguAngkutanUmum(au, menit) + au.waktuTempuh + au.keterlambatan;
+}
+
+// Fungsi untuk menghitung berapa menit lagi bobot angkutan umum (termasuk tidak tersedia) tetap sama bagi penumpang yang
+// tiba pada menit tertentu: tiba j menit kemudian, 0 <= j <= hasil, memberi bobot yang sama. Hanya layanan tanpa
+// frekuensi yang sudah beroperasi yang bobotnya tetap; waktu tunggu layanan lain berubah setiap menit.
+int menitBobotTetap(const AngkutanUmum &au, int menit, int hari) {
+    if (bobotAngkutanUmum(au, menit, hari) < 0) {
+        // Layanan yang tidak tersedia tidak menjadi tersedia jika penumpang tiba lebih lambat
+        return menit < 0 ? 0 : numeric_limits<int>::max();
+    }
+    if (au.frekuensi > 0 || menit < waktuKeMenit(au.jamMulaiOperasional)) return 0;
+    return waktuKeMenit(au.jamTutupOperasional) - menit;
+}
+
+// Fungsi untuk menghitung bobot edge ringkas (waktu tunggu + waktu tempuh) bagi penumpang yang tiba di kota asal edge
+// pada menit tertentu, -1 jika tidak tersedia. Aturannya sama dengan isAngkutanUmumAvailable dan waktuTungguAngkutanUmum.
+int bobotEdgeKompak(const EdgeKompak &edge, int menit, int hari) {
+    if (hari >= 1 && hari <= 7 && !(edge.hariMask & (1 << (hari - 1)))) return -1;
+    if (menit < 0 || edge.mulai < 0 || edge.tutup < 0) return -1;
+
+    int berangkat = max(menit, edge.mulai);
+    if (edge.frekuensi > 0 && menit > edge.mulai) {
+        berangkat = edge.mulai + (menit - edge.mulai + edge.frekuensi - 1) / edge.frekuensi * edge.frekuensi;
+    }
+    if (berangkat > edge.tutup) return -1;
+    return berangkat - menit + edge.waktuTempuh;
+}
+
+// Antrian prioritas (jarak, kota) dengan jarak terkecil di atas
+typedef priority_queue<pair<int, string>, vector<pair<int, string>>, greater<pair<int, string>>> AntrianDijkstra;
+
+// Antrian prioritas (jarak, ID kota) untuk graf kompak dan graf berhalaman
+typedef priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> AntrianDijkstraId;
+
+// Kebijakan pencarian rute. Inti pencarian (cariDenganKebijakan) menerima satu kebijakan untuk setiap aspek:
+//   Biaya     : int operator()(dari, edge, menit) -> bobot edge yang sudah lolos filter
+//               int menitTiba(kota, menitBerangkat, jarak) -> waktu tiba di kota yang akan diekspansi
+//               void dipilih(dari, ke, edge, menit) -> dipanggil saat edge menjadi edge pohon; kebijakan yang biayanya
+//               bergantung pada edge sebelumnya (misalnya jumlah transit) mencatat statusnya per kota di sini
+//   Filter    : bool operator()(dari, ke, edge, menit) -> apakah edge boleh dilewati
+// menit adalah waktu tiba di kota `dari` (hasil menitTiba), bukan waktu berangkat dari kota asal.
+//   Heuristik : int operator()(kota) -> batas bawah sisa jarak ke tujuan (0 = Dijkstra biasa)
+//   Henti     : bool operator()(kota, jarak) -> hentikan pencarian saat kota ini akan diekspansi
+// Kebijakan adalah parameter template, sehingga setiap kombinasi dikompilasi menjadi satu fungsi tanpa pemanggilan tidak langsung.
+// Kota dan edge bergantung pada graf yang ditelusuri: string dan AngkutanUmum untuk Graph, ID kota dan EdgeKompak untuk
+// graf kompak dan graf berhalaman.
+
+// Biaya: waktu tunggu keberangkatan berikutnya + waktu tempuh + keterlambatan dari feed gangguan.
+// Jarak sama dengan lama perjalanan, sehingga waktu tiba cukup dihitung dari jarak dan tidak ada status per kota.
+struct BiayaWaktuTempuh {
+    template <typename Kota>
+    int operator()(const Kota &, const AngkutanUmum &au, int menit) const {
+        return waktuTungguAngkutanUmum(au, menit) + au.waktuTempuh + au.keterlambatan;
+    }
+    // Edge ringkas sudah lolos filter hari, dan keterlambatan sudah termasuk dalam waktu tempuhnya
+    template <typename Kota>
+    int operator()(const Kota &, const EdgeKompak &edge, int menit) const {
+        return bobotEdgeKompak(edge, menit, 0);
+    }
+    template <typename Kota>
+    int menitTiba(const Kota &, int menitBerangkat, int jarak) const {
+        return menitBerangkat < 0 ? -1 : menitBerangkat + jarak;
+    }
+    template <typename Kota, typename Edge>
+    void dipilih(const Kota &, const Kota &, const Edge &, int) const {}
+};
+
+// Biaya: lama perjalanan ditambah penalti setiap kali penumpang berganti layanan (nama angkutan umum berbeda dari layanan
+// yang dipakai untuk tiba di kota asal edge). Jarak tidak lagi sama dengan lama perjalanan, sehingga waktu tiba dan layanan
+// terakhir setiap kota dicatat di `tiba` melalui dipilih(). Hanya satu label per kota yang disimpan, sehingga hasilnya
+// perkiraan: rute yang tiba di kota perantara dengan layanan lain dan penalti total lebih kecil bisa terlewat.
+struct BiayaTransitMinimum {
+    int penaltiTransit;
+    map<string, pair<int, string>> &tiba; // Kota -> (menit tiba, layanan terakhir), diisi selama pencarian
+    int operator()(const string &dari, const AngkutanUmum &au, int menit) const {
+        auto it = tiba.find(dari);
+        bool transit = it != tiba.end() && it->second.second != au.nama;
+        return BiayaWaktuTempuh()(dari, au, menit) + (transit ? penaltiTransit : 0);
+    }
+    int menitTiba(const string &kota, int menitBerangkat, int) const {
+        auto it = tiba.find(kota);
+        return it == tiba.end() ? menitBerangkat : it->second.first;
+    }
+    void dipilih(const string &dari, const string &ke, const AngkutanUmum &au, int menit) const {
+        tiba[ke] = {menit < 0 ? -1 : menit + BiayaWaktuTempuh()(dari, au, menit), au.nama};
+    }
+};
+
+// Filter: angkutan umum beroperasi saat penumpang tiba di kota asal edge dan tidak dibatalkan
+struct FilterTersedia {
+    int hari;
+    template <typename Kota>
+    bool operator()(const Kota &, const Kota &, const AngkutanUmum &au, int menit) const {
+        return !au.dibatalkan && isAngkutanUmumAvailable(au, menit, hari);
+    }
+    // Layanan batal tidak ikut disalin ke edge ringkas
+    template <typename Kota>
+    bool operator()(const Kota &, const Kota &, const EdgeKompak &edge, int menit) const {
+        return bobotEdgeKompak(edge, menit, hari) >= 0;
+    }
+};
+
+// Filter: seperti FilterTersedia, tetapi edge antar pasangan kota tertentu tidak boleh dilewati
+struct FilterTersediaKecualiEdge {
+    FilterTersedia tersedia;
+    const set<pair<string, string>> &dilarang; // Pasangan (kota asal, kota tujuan)
+    bool operator()(const string &dari, const string &ke, const AngkutanUmum &au, int menit) const {
+        return !dilarang.count({dari, ke}) && tersedia(dari, ke, au, menit);
+    }
+};
+
+// Filter: meneruskan filter lain sambil mencatat menit terkecil dari menitBobotTetap semua edge yang diperiksa.
+// Jika berangkat j menit lebih lambat (j <= menitTetap), setiap edge yang diperiksa memiliki bobot yang sama sehingga
+// pencarian berjalan identik dan hanya bergeser j menit.
+template <typename Filter>
+struct FilterCatatMenitTetap {
+    Filter dasar;
+    int hari;
+    int &menitTetap;
+    bool operator()(const string &dari, const string &ke, const AngkutanUmum &au, int menit) const {
+        menitTetap = min(menitTetap, menitBobotTetap(au, menit, hari));
+        return dasar(dari, ke, au, menit);
+    }
+};
+
+// Heuristik: tidak ada perkiraan sisa jarak (Dijkstra biasa)
+struct TanpaHeuristik {
+    template <typename Kota>
+    int operator()(const Kota &) const { return 0; }
+};
+
+// Henti: kota dengan jarak melebihi batas menit tidak diekspansi (batas maksimum = pohon lengkap).
+// Hanya tepat tanpa heuristik: dengan heuristik antrian terurut menurut jarak + heuristik, sehingga kota yang masih
+// di bawah batas bisa berada di belakang kota yang sudah melewatinya. cariDenganKebijakan menolak kombinasi tersebut.
+struct HentiBatasWaktu {
+    int batasMenit;
+    template <typename Kota>
+    bool operator()(const Kota &, int jarak) const { return jarak > batasMenit; }
+};
+
+// Henti: jarak ke kota tujuan sudah final begitu kota tujuan akan diekspansi
+template <typename Kota>
+struct HentiDiTujuan {
+    const Kota &tujuan;
+    bool operator()(const Kota &kota, int) const { return kota == tujuan; }
+};
+
+// Akses graf untuk inti pencarian. Setiap akses menyediakan:
+//   untukSetiapEdge(kota, f) -> memanggil f(kotaTujuan, edge) untuk setiap edge keluar dari kota
+//   diperbaiki(kota)         -> dipanggil setelah jarak sebuah kota diperbaiki (misalnya untuk prefetch halaman)
+// Akses graf kompak dan graf berhalaman didefinisikan bersama struktur datanya di bawah.
+
+// Akses graf berbasis map (Graph)
+struct AksesGraph {
+    const Graph &graph;
+    template <typename F>
+    void untukSetiapEdge(const string &kota, const F &f) const {
+        for (const auto &neighbor : graph.adjList.at(kota)) {
+            f(neighbor.first, neighbor.second);
+        }
+    }
+    void diperbaiki(const string &) const {}
+};
+
+// Relaksasi semua edge keluar dari satu kota: perbaiki(kotaTujuan, edge, jarakBaru) dipanggil untuk setiap edge yang
+// lolos filter. Akses graf dapat menyediakan versi khusus untuk kombinasi kebijakan tertentu (lihat graf kompak).
+template <typename Akses, typename Kota, typename Biaya, typename Filter, typename Dist, typename Perbaiki>
+void relaksasiKota(const Akses &akses, const Kota &current, int jarak, int menit, const Biaya &biaya, const Filter &filter,
+                   const Dist &, const Perbaiki &perbaiki) {
+    akses.untukSetiapEdge(current, [&](const Kota &next, const auto &edge) {
+        if (!filter(current, next, edge, menit)) return;
+        perbaiki(next, edge, jarak + biaya(current, edge, menit));
+    });
+}
+
+// Inti pencarian rute yang dipakai bersama oleh semua varian pencarian dan semua bentuk graf.
+// dist, prev, dan pq harus sudah diinisialisasi oleh pemanggil (lihat mulaiPencarian); prioritas di pq adalah jarak + heuristik.
+// Edge dari sebuah kota dievaluasi pada waktu tiba di kota itu. Karena menunggu tidak pernah membuat penumpang tiba
+// lebih awal, tiba lebih awal di sebuah kota tidak pernah merugikan dan Dijkstra tetap tepat.
+template <typename Akses, typename Dist, typename Prev, typename Antrian, typename Biaya, typename Filter, typename Heuristik,
+          typename Henti>
+void cariDenganKebijakan(const Akses &akses, int menitBerangkat, Dist &dist, Prev &prev, Antrian &pq, const Biaya &biaya,
+                         const Filter &filter, const Heuristik &heuristik, const Henti &henti) {
+    static_assert(!is_same<Henti, HentiBatasWaktu>::value || is_same<Heuristik, TanpaHeuristik>::value,
+                  "HentiBatasWaktu hanya tepat jika antrian terurut menurut jarak (TanpaHeuristik)");
+
+    while (!pq.empty()) {
+        auto current = pq.top().second;
+        int jarak = pq.top().first - heuristik(current);
+
+        // Skip jika sudah ada jarak yang lebih pendek untuk kota ini (entri antrian yang usang)
+        if (jarak > dist[current]) {
+            pq.pop();
+            continue;
+        }
+
+        // Berhenti sesuai aturan penghentian (batas waktu, kota tujuan, ...); kota ini tetap di antrian sehingga
+        // pencarian bisa dilanjutkan dengan pq yang sama
+        if (henti(current, jarak)) break;
+        pq.pop();
+
+        // Relaksasi semua tetangga dari kota saat ini, update jarak jika menemukan jarak yang lebih pendek
+        int menitTiba = biaya.menitTiba(current, menitBerangkat, jarak);
+        relaksasiKota(akses, current, jarak, menitTiba, biaya, filter, dist, [&](const auto &next, const auto &edge, int jarakBaru) {
+            if (jarakBaru < dist[next]) {
+                dist[next] = jarakBaru;
+                prev[next] = current;
+                biaya.dipilih(current, next, edge, menitTiba);
+                pq.push({jarakBaru + heuristik(next), next});
+                akses.diperbaiki(next);
+            }
+        });
+    }
+}
+
+// Fungsi untuk menyiapkan status pencarian pada Graph: semua kota berjarak tak hingga, prev kosong, dan kota asal
+// berjarak 0 sebagai satu-satunya isi antrian. asal kosong berarti pencarian tanpa kota asal (antrian kosong).
+void mulaiPencarian(const Graph &graph, const string &asal, map<string, int> &dist, map<string, string> &prev, AntrianDijkstra &pq) {
+    dist.clear();
+    prev.clear();
+    pq = AntrianDijkstra();
+    for (const auto &loc : graph.adjList) {
+        dist[loc.first] = numeric_limits<int>::max();
+    }
+    if (!asal.empty()) {
+        dist[asal] = 0;
+        pq.push({0, asal});
+    }
+}
+
+// Fungsi untuk menyiapkan status pencarian pada graf ber-ID kota (graf kompak dan graf berhalaman); prev -1 = tidak ada
+void mulaiPencarian(size_t jumlahKota, int idAsal, vector<int> &dist, vector<int> &prev, AntrianDijkstraId &pq) {
+    dist.assign(jumlahKota, numeric_limits<int>::max());
+    prev.assign(jumlahKota, -1);
+    pq = AntrianDijkstraId();
+    dist[idAsal] = 0;
+    pq.push({0, idAsal});
+}
+
+// Dijkstra berbobot waktu dengan filter ketersediaan, dipakai oleh pencarian kota terjangkau dan pohon rute.
+// dist, prev, dan pq harus sudah diinisialisasi oleh pemanggil (lihat mulaiPencarian); kota dengan jarak melebihi batasMenit tidak diekspansi.
+void jalankanDijkstra(const Graph &graph, const string &waktu, int hari, map<string, int> &dist, map<string, string> &prev,
+                      AntrianDijkstra &pq, int batasMenit = numeric_limits<int>::max()) {
+    cariDenganKebijakan(AksesGraph{graph}, waktuKeMenit(waktu), dist, prev, pq, BiayaWaktuTempuh(), FilterTersedia{hari},
+                        TanpaHeuristik(), HentiBatasWaktu{batasMenit});
+}
+
+// Fungsi untuk merekonstruksi rute dari kota asal ke kota tujuan berdasarkan tabel prev
+vector<string> rekonstruksiRute(const map<string, string> &prev, const string &tujuan) {
+    vector<string> path;
+    for (string at = tujuan; !at.empty();) {
+        path.push_back(at);
+        auto it = prev.find(at);
+        at = it == prev.end() ? "" : it->second;
+    }
+    reverse(path.begin(), path.end());
+
+    // Rute hanya berisi satu kota jika asal == tujuan atau tujuan tidak terjangkau (tidak punya prev)
+    if (path.size() == 1) {
+        return {}; // Tidak ada rute yang ditemukan
+    }
+
+    return path;
+}
+
+// Fungsi untuk merekonstruksi rute pada graf ber-ID kota; namaKota memetakan ID kota ke namanya
+vector<string> rekonstruksiRute(const vector<int> &prev, const vector<string> &namaKota, int tujuan) {
+    vector<string> path;
+    for (int at = tujuan; at != -1; at = prev[at]) {
+        path.push_back(namaKota[at]);
+    }
+    reverse(path.begin(), path.end());
+
+    // Sama seperti versi map: satu kota berarti asal == tujuan atau tujuan tidak terjangkau
+    if (path.size() == 1) {
+        return {}; // Tidak ada rute yang ditemukan
+    }
+
+    return path;
+}
+
+// Fungsi untuk mencari rute tercepat berdasarkan angkutan umum yang tersedia dan waktu tempuh tercepat
+vector<string> cariRuteTercepat(const Graph &graph, const string &asal, const string &tujuan, const string &waktu, int hari = 0) {
+    if (graph.adjList.find(asal) == graph.adjList.end() || graph.adjList.find(tujuan) == graph.adjList.end()) {
+        return {}; // Kota asal atau tujuan tidak ada di dalam graf
+    }
+
+    // Jarak semua lokasi tak hingga, kecuali kota asal yang berjarak 0
+    map<string, int> dist;
+    map<string, string> prev;
+    AntrianDijkstra pq;
+    mulaiPencarian(graph, asal, dist, prev, pq);
+
+    // Proses algoritma Dijkstra, berhenti begitu jarak ke kota tujuan sudah final
+    cariDenganKebijakan(AksesGraph{graph}, waktuKeMenit(waktu), dist, prev, pq, BiayaWaktuTempuh(), FilterTersedia{hari},
+                        TanpaHeuristik(), HentiDiTujuan<string>{tujuan});
+
+    // Rekonstruksi rute tercepat dari kota asal ke kota tujuan
+    return rekonstruksiRute(prev, tujuan);
+}
+
+// Fungsi untuk mencari rute dengan transit sesedikit mungkin: setiap pergantian layanan dihitung seperti penaltiTransit
+// menit tambahan, sehingga rute yang sedikit lebih lambat tetapi tanpa ganti angkutan lebih diutamakan.
+// layanan (opsional) diisi dengan nama layanan yang dipakai untuk setiap ruas rute.
+vector<string> cariRuteTransitMinimum(const Graph &graph, const string &asal, const string &tujuan, const string &waktu, int hari,
+                                      int penaltiTransit, vector<string> *layanan = nullptr) {
+    if (graph.adjList.find(asal) == graph.adjList.end() || graph.adjList.find(tujuan) == graph.adjList.end()) {
+        return {}; // Kota asal atau tujuan tidak ada di dalam graf
+    }
+
+    map<string, int> dist;
+    map<string, string> prev;
+    map<string, pair<int, string>> tiba;
+    AntrianDijkstra pq;
+    mulaiPencarian(graph, asal, dist, prev, pq);
+
+    cariDenganKebijakan(AksesGraph{graph}, waktuKeMenit(waktu), dist, prev, pq, BiayaTransitMinimum{penaltiTransit, tiba},
+                        FilterTersedia{hari}, TanpaHeuristik(), HentiDiTujuan<string>{tujuan});
+
+    vector<string> rute = rekonstruksiRute(prev, tujuan);
+    if (layanan) {
+        layanan->clear();
+        for (size_t i = 1; i < rute.size(); ++i) {
+            layanan->push_back(tiba[rute[i]].second);
+        }
+    }
+    return rute;
+}
+
+// Fungsi untuk mencari semua kota yang dapat dicapai dari kota asal dalam batas waktu tertentu (isochrone).
+// Hasil berupa pasangan (kota, lama perjalanan dalam menit), terurut dari yang paling cepat dicapai.
+vector<pair<string, int>> cariKotaTerjangkau(const Graph &graph, const string &asal, const string &waktu, int batasMenit, int hari = 0) {
+    vector<pair<string, int>> hasil;
+    if (graph.adjList.find(asal) == graph.adjList.end()) {
+        return hasil; // Kota asal tidak ada di dalam graf
+    }
+
+    map<string, int> dist;
+    map<string, string> prev;
+    AntrianDijkstra pq;
+    mulaiPencarian(graph, asal, dist, prev, pq);
+
+    jalankanDijkstra(graph, waktu, hari, dist, prev, pq, batasMenit);
+
+    for (const auto &d : dist) {
+        if (d.second <= batasMenit) {
+            hasil.push_back({d.first, d.second});
+        }
+    }
+    sort(hasil.begin(), hasil.end(), [](const pair<string, int> &a, const pair<string, int> &b) {
+        return a.second != b.second ? a.second < b.second : a.first < b.first;
+    });
+    return hasil;
+}
+
+#ifdef PROJEKAN_THREAD
+// Fungsi untuk mengerjakan tugas dari batch yang sedang berjalan sampai habis; kunci harus dipegang pemanggil
+void kerjakanBatch(KumpulanThread &kumpulan, unique_lock<mutex> &lk) {
+    while (kumpulan.tugasBerikutnya < kumpulan.jumlahTugas) {
+        size_t i = kumpulan.tugasBerikutnya++;
+        const function<void(size_t)> &tugas = *kumpulan.tugas;
+        lk.unlock();
+        tugas(i);
+        lk.lock();
+        if (++kumpulan.tugasSelesai == kumpulan.jumlahTugas) {
+            kumpulan.batchSelesai.notify_all();
+        }
+    }
+}
+
+// Fungsi untuk kumpulan thread bersama; thread dibuat pada pemakaian pertama dan hidup sampai program selesai.
+// Pemanggil ikut bekerja, sehingga jumlah thread pekerja satu lebih sedikit dari jumlah core.
+KumpulanThread &kumpulanThreadBersama() {
+    static KumpulanThread kumpulan;
+    static once_flag sudahDibuat;
+    call_once(sudahDibuat, []() {
+        size_t jumlahPekerja = max(1u, thread::hardware_concurrency()) - 1;
+        for (size_t t = 0; t < jumlahPekerja; ++t) {
+            kumpulan.pekerja.emplace_back([]() {
+                long generasiTerakhir = 0;
+                unique_lock<mutex> lk(kumpulan.kunci);
+                while (true) {
+                    kumpulan.adaBatch.wait(lk, [&]() { return kumpulan.berhenti || kumpulan.generasi != generasiTerakhir; });
+                    if (kumpulan.berhenti) return;
+                    generasiTerakhir = kumpulan.generasi;
+                    kerjakanBatch(kumpulan, lk);
+                }
+            });
+        }
+    });
+    return kumpulan;
+}
+
+// Fungsi untuk menjalankan tugas(0) .. tugas(jumlahTugas - 1) di kumpulan thread bersama dan menunggu semuanya selesai
+void jalankanParalel(size_t jumlahTugas, const function<void(size_t)> &tugas) {
+    KumpulanThread &kumpulan = kumpulanThreadBersama();
+    lock_guard<mutex> satuBatch(kumpulan.kunciPemanggil);
+    unique_lock<mutex> lk(kumpulan.kunci);
+    kumpulan.tugas = &tugas;
+    kumpulan.jumlahTugas = jumlahTugas;
+    kumpulan.tugasBerikutnya = 0;
+    kumpulan.tugasSelesai = 0;
+    ++kumpulan.generasi;
+    kumpulan.adaBatch.notify_all();
+    kerjakanBatch(kumpulan, lk);
+    kumpulan.batchSelesai.wait(lk, [&]() { return kumpulan.tugasSelesai == kumpulan.jumlahTugas; });
+    kumpulan.tugas = nullptr;
+}
+
+// Fungsi untuk jumlah thread yang mengerjakan satu batch (thread pekerja ditambah pemanggil)
+size_t jumlahThreadParalel() {
+    return kumpulanThreadBersama().pekerja.size() + 1;
+}
+#else
+// Tanpa dukungan thread: tugas dikerjakan berurutan oleh pemanggil
+void jalankanParalel(size_t jumlahTugas, const function<void(size_t)> &tugas) {
+    for (size_t i = 0; i < jumlahTugas; ++i) {
+        tugas(i);
+    }
+}
+
+size_t jumlahThreadParalel() {
+    return 1;
+}
+#endif
+
+// Fungsi untuk membangun pohon jalur terpendek lengkap dari kota asal
+PohonRute bangunPohonRute(const Graph &graph, const string &asal, const string &waktu, int hari) {
+    PohonRute pohon;
+    pohon.asal = asal;
+    pohon.waktu = waktu;
+    pohon.hari = hari;
+    AntrianDijkstra pq;
+    mulaiPencarian(graph, asal, pohon.dist, pohon.prev, pq);
+    jalankanDijkstra(graph, waktu, hari, pohon.dist, pohon.prev, pq);
+    return pohon;
+}
+
+// Fungsi untuk membangun daftar pendahulu (adjacency terbalik tanpa duplikat) dari graf
+void bangunDaftarPendahulu(const Graph &graph, map<string, vector<string>> &pendahulu) {
+    pendahulu.clear();
+    for (const auto &entry : graph.adjList) {
+        for (const auto &neighbor : entry.second) {
+            vector<string> &daftar = pendahulu[neighbor.first];
+            if (find(daftar.begin(), daftar.end(), entry.first) == daftar.end()) {
+                daftar.push_back(entry.first);
+            }
+        }
+    }
+}
+
+// Fungsi untuk menghitung bobot terkecil dari semua angkutan umum u -> v bagi penumpang yang tiba di u pada menit
+// tertentu, -1 jika tidak ada yang tersedia
+int bobotTerbaikAntarKota(const Graph &graph, const string &u, const string &v, int menit, int hari) {
+    int terbaik = -1;
+    for (const auto &neighbor : graph.adjList.at(u)) {
+        if (neighbor.first != v) continue;
+        int weight = bobotAngkutanUmum(neighbor.second, menit, hari);
+        if (weight >= 0 && (terbaik < 0 || weight < terbaik)) {
+            terbaik = weight;
+        }
+    }
+    return terbaik;
+}
+
+// Fungsi untuk memperbaiki pohon rute setelah bobot sekumpulan edge berubah (dynamic shortest path).
+// Kota di bawah edge pohon yang menjadi lebih lambat atau dibatalkan dihapus dari pohon lalu dihitung ulang dari
+// tetangga di luar subpohon tersebut; edge yang menjadi lebih cepat cukup melanjutkan Dijkstra dari kota tujuannya.
+// Semua perubahan ditangani dalam satu Dijkstra. Mengembalikan true jika pohon berubah.
+bool perbaikiPohonRute(const Graph &graph, const map<string, vector<string>> &pendahulu, PohonRute &pohon,
+                       const set<pair<string, string>> &edgeBerubah) {
+    const int TAK_HINGGA = numeric_limits<int>::max();
+    int menitAwal = waktuKeMenit(pohon.waktu);
+    auto bobotDari = [&](const string &u, const string &v) {
+        int weight = bobotTerbaikAntarKota(graph, u, v, menitAwal + pohon.dist[u], pohon.hari);
+        return weight < 0 ? static_cast<long long>(TAK_HINGGA) : static_cast<long long>(pohon.dist[u]) + weight;
+    };
+
+    // Akar subpohon yang jaraknya bisa bertambah: kota tujuan edge pohon yang menjadi lebih lambat
+    vector<string> tumpukan;
+    for (const auto &edge : edgeBerubah) {
+        const string &u = edge.first, &v = edge.second;
+        if (!pohon.dist.count(u) || !pohon.dist.count(v) || pohon.dist[u] == TAK_HINGGA) continue;
+        auto itPrev = pohon.prev.find(v);
+        if (itPrev != pohon.prev.end() && itPrev->second == u && bobotDari(u, v) > pohon.dist[v]) {
+            tumpukan.push_back(v);
+        }
+    }
+
+    // Kumpulkan subpohon dengan menelusuri edge keluar yang dipakai pohon (prev[next] == kota)
+    set<string> terdampak;
+    while (!tumpukan.empty()) {
+        string kota = tumpukan.back();
+        tumpukan.pop_back();
+        if (!terdampak.insert(kota).second) continue;
+        for (const auto &neighbor : graph.adjList.at(kota)) {
+            auto itAnak = pohon.prev.find(neighbor.first);
+            if (itAnak != pohon.prev.end() && itAnak->second == kota) {
+                tumpukan.push_back(neighbor.first);
+            }
+        }
+    }
+    for (const auto &kota : terdampak) {
+        pohon.dist[kota] = TAK_HINGGA;
+        pohon.prev.erase(kota);
+    }
+
+    // Jarak kota di luar subpohon tetap benar, sehingga pendahulunya menjadi titik awal untuk kota yang terdampak
+    AntrianDijkstra pq;
+    auto perbarui = [&](const string &asal, const string &kota) {
+        if (terdampak.count(asal) || pohon.dist[asal] == TAK_HINGGA) return false;
+        long long jarakBaru = bobotDari(asal, kota);
+        if (jarakBaru >= pohon.dist[kota]) return false;
+        pohon.dist[kota] = static_cast<int>(jarakBaru);
+        pohon.prev[kota] = asal;
+        return true;
+    };
+    for (const auto &kota : terdampak) {
+        auto itPendahulu = pendahulu.find(kota);
+        if (itPendahulu != pendahulu.end()) {
+            for (const auto &asal : itPendahulu->second) perbarui(asal, kota);
+        }
+        if (pohon.dist[kota] != TAK_HINGGA) {
+            pq.push({pohon.dist[kota], kota});
+        }
+    }
+
+    // Edge yang menjadi lebih cepat memperbaiki kota tujuannya secara langsung
+    bool berubah = !terdampak.empty();
+    for (const auto &edge : edgeBerubah) {
+        if (!pohon.dist.count(edge.first) || !pohon.dist.count(edge.second)) continue;
+        if (perbarui(edge.first, edge.second)) {
+            pq.push({pohon.dist[edge.second], edge.second});
+            berubah = true;
+        }
+    }
+    jalankanDijkstra(graph, pohon.waktu, pohon.hari, pohon.dist, pohon.prev, pq);
+    return berubah;
+}
+
+// Fungsi untuk menerapkan semua perubahan edge di cache yang belum diterapkan ke sebuah pohon.
+// Jika edge yang berubah lebih dari seperempat jumlah kota, pohon dihitung ulang dari awal karena lebih murah.
+// Mengembalikan true jika pohon diperbaiki atau dihitung ulang.
+bool perbaruiPohonRute(const Graph &graph, CacheRute &cache, PohonRute &pohon) {
+    long akhir = cache.perubahanAwal + static_cast<long>(cache.perubahan.size());
+    if (pohon.perubahanDiterapkan >= akhir) return false;
+
+    set<pair<string, string>> edgeBerubah(cache.perubahan.begin() + (pohon.perubahanDiterapkan - cache.perubahanAwal),
+                                          cache.perubahan.end());
+    pohon.perubahanDiterapkan = akhir;
+    if (edgeBerubah.size() * 4 > pohon.dist.size()) {
+        PohonRute baru = bangunPohonRute(graph, pohon.asal, pohon.waktu, pohon.hari);
+        pohon.dist.swap(baru.dist);
+        pohon.prev.swap(baru.prev);
+        return true;
+    }
+    return perbaikiPohonRute(graph, cache.pendahulu, pohon, edgeBerubah);
+}
+
+// Fungsi untuk menerapkan perubahan yang tertunda ke semua pohon di cache lalu mengosongkan catatan perubahan.
+// Waktu dan jumlah pohon yang diperbaiki ditambahkan ke statistik.
+void perbaruiSemuaPohonRute(const Graph &graph, CacheRute &cache, StatistikFeed &statistik) {
+    auto mulai = chrono::steady_clock::now();
+    for (auto &entry : cache.pohon) {
+        if (perbaruiPohonRute(graph, cache, entry.second)) {
+            statistik.pohonDiperbaiki++;
+        }
+    }
+    statistik.perbaikanMikrodetik += chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count();
+    cache.perubahanAwal += static_cast<long>(cache.perubahan.size());
+    cache.perubahan.clear();
+}
+
+// Fungsi untuk membuang catatan perubahan yang sudah diterapkan ke semua pohon di cache
+void rapikanCatatanPerubahan(CacheRute &cache) {
+    long terlama = cache.perubahanAwal + static_cast<long>(cache.perubahan.size());
+    for (const auto &entry : cache.pohon) {
+        terlama = min(terlama, entry.second.perubahanDiterapkan);
+    }
+    cache.perubahan.erase(cache.perubahan.begin(), cache.perubahan.begin() + (terlama - cache.perubahanAwal));
+    cache.perubahanAwal = terlama;
+}
+
+// Fungsi untuk mencari rute tercepat memakai cache pohon rute. Pohon dibangun sekali per (asal, waktu, hari),
+// diperbaiki saat dipakai jika feed gangguan mengubah edge sejak pemakaian terakhir, dan pohon yang paling lama
+// tidak dipakai dikeluarkan saat cache penuh.
+vector<string> cariRuteTercepatTersimpan(CacheRute &cache, const Graph &graph, const string &asal, const string &tujuan,
+                                         const string &waktu, int hari = 0) {
+    if (graph.adjList.find(asal) == graph.adjList.end() || graph.adjList.find(tujuan) == graph.adjList.end()) {
+        return {}; // Kota asal atau tujuan tidak ada di dalam graf
+    }
+
+    const size_t KAPASITAS_CACHE_RUTE = 64;
+    if (cache.pohon.empty()) {
+        bangunDaftarPendahulu(graph, cache.pendahulu);
+        rapikanCatatanPerubahan(cache);
+    }
+    string kunci = asal + "|" + waktu + "|" + to_string(hari);
+    auto it = cache.pohon.find(kunci);
+    if (it == cache.pohon.end()) {
+        if (cache.pohon.size() >= KAPASITAS_CACHE_RUTE) {
+            auto korban = cache.pohon.begin();
+            for (auto itPohon = cache.pohon.begin(); itPohon != cache.pohon.end(); ++itPohon) {
+                if (itPohon->second.terakhirDipakai < korban->second.terakhirDipakai) korban = itPohon;
+            }
+            cache.pohon.erase(korban);
+            rapikanCatatanPerubahan(cache);
+        }
+        it = cache.pohon.insert({kunci, bangunPohonRute(graph, asal, waktu, hari)}).first;
+        it->second.perubahanDiterapkan = cache.perubahanAwal + static_cast<long>(cache.perubahan.size());
+    } else if (perbaruiPohonRute(graph, cache, it->second)) {
+        rapikanCatatanPerubahan(cache);
+    }
+    it->second.terakhirDipakai = ++cache.jamPakai;
+    return rekonstruksiRute(it->second.prev, tujuan);
+}
+
+// Fungsi untuk membaca satu baris feed gangguan. Format:
+//   TERLAMBAT <nama> <asal> <tujuan> <jamMulai> <menit>   (menit 0 = hapus keterlambatan)
+//   BATAL <nama> <asal> <tujuan> <jamMulai>
+//   PULIH <nama> <asal> <tujuan> <jamMulai>
+bool bacaGangguan(const string &line, GangguanLayanan &gangguan) {
+    stringstream ss(line);
+    if (!(ss >> gangguan.jenis >> gangguan.nama >> gangguan.kotaAsal >> gangguan.kotaTujuan >> gangguan.jamMulaiOperasional)) {
+        return false;
+    }
+    if (gangguan.jenis == "TERLAMBAT") {
+        return static_cast<bool>(ss >> gangguan.menit) && gangguan.menit >= 0;
+    }
+    return gangguan.jenis == "BATAL" || gangguan.jenis == "PULIH";
+}
+
+// Fungsi untuk menerapkan satu gangguan langsung ke overlay edge di graf tanpa membangun ulang graf.
+// Mengembalikan false jika layanan yang dimaksud tidak ada di graf.
+bool terapkanGangguan(Graph &graph, const GangguanLayanan &gangguan) {
+    auto it = graph.adjList.find(gangguan.kotaAsal);
+    if (it == graph.adjList.end()) return false;
+
+    bool ditemukan = false;
+    for (auto &neighbor : it->second) {
+        AngkutanUmum &au = neighbor.second;
+        if (au.nama != gangguan.nama || au.kotaTujuan != gangguan.kotaTujuan || au.jamMulaiOperasional != gangguan.jamMulaiOperasional) {
+            continue;
+        }
+        ditemukan = true;
+        if (gangguan.jenis == "TERLAMBAT") {
+            au.keterlambatan = gangguan.menit;
+        } else if (gangguan.jenis == "BATAL") {
+            au.dibatalkan = true;
+        } else {
+            au.keterlambatan = 0;
+            au.dibatalkan = false;
+        }
+    }
+    return ditemukan;
+}
+
+// Fungsi untuk menghitung banyaknya layanan yang sedang terlambat dan dibatalkan menurut overlay feed gangguan
+void hitungOverlayGangguan(const Graph &graph, int &jumlahTerlambat, int &jumlahBatal) {
+    jumlahTerlambat = jumlahBatal = 0;
+    for (const auto &entry : graph.adjList) {
+        for (const auto &neighbor : entry.second) {
+            jumlahTerlambat += neighbor.second.keterlambatan > 0;
+            jumlahBatal += neighbor.second.dibatalkan;
+        }
+    }
+}
+
+// Fungsi untuk memproses feed gangguan baris demi baris (file atau pipe). Setiap event hanya mengubah overlay edge
+// dan dicatat di cache; pohon rute diperbaiki saat dipakai (lihat cariRuteTercepatTersimpan). Jika catatan lebih
+// panjang dari jumlah kota, semua pohon diperbaiki sekaligus agar memori catatan tetap terbatas.
+StatistikFeed prosesFeedGangguan(Graph &graph, CacheRute &cache, istream &feed) {
+    StatistikFeed statistik;
+    string line;
+    while (getline(feed, line)) {
+        if (line.empty()) continue;
+        statistik.jumlahEvent++;
+
+        auto mulai = chrono::steady_clock::now();
+        GangguanLayanan gangguan;
+        if (!bacaGangguan(line, gangguan) || !terapkanGangguan(graph, gangguan)) {
+            statistik.tidakDikenal++;
+            continue;
+        }
+        statistik.diterapkan++;
+        if (!cache.pohon.empty()) {
+            cache.perubahan.push_back({gangguan.kotaAsal, gangguan.kotaTujuan});
+        }
+        statistik.totalMikrodetik += chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count();
+
+        if (cache.perubahan.size() > graph.adjList.size()) {
+            perbaruiSemuaPohonRute(graph, cache, statistik);
+        }
+    }
+    return statistik;
+}
+
+// Fungsi untuk mencari rute alternatif (rute tercepat kedua) jika rute tercepat pertama sudah diketahui.
+// Jika menitTetap diberikan, nilainya diperkecil sesuai edge yang diperiksa (lihat FilterCatatMenitTetap).
+vector<string> cariRuteAlternatifDari(const Graph &graph, const string &asal, const string &tujuan, const string &waktu, int hari,
+                                      const vector<string> &ruteTercepat, int *menitTetap = nullptr) {
+    if (ruteTercepat.empty()) {
+        return {}; // Tanpa rute tercepat, rute kedua pun tidak ada
+    }
+
+    // Edge pada rute tercepat pertama dilarang oleh filter (tanpa menyalin graf)
+    set<pair<string, string>> dilarang;
+    for (size_t i = 0; i + 1 < ruteTercepat.size(); ++i) {
+        dilarang.insert({ruteTercepat[i], ruteTercepat[i + 1]});
+    }
+
+    // Mencari rute tercepat kedua
+    map<string, int> dist;
+    map<string, string> prev;
+    AntrianDijkstra pq;
+    mulaiPencarian(graph, asal, dist, prev, pq);
+    FilterTersediaKecualiEdge filter{{hari}, dilarang};
+    if (menitTetap) {
+        cariDenganKebijakan(AksesGraph{graph}, waktuKeMenit(waktu), dist, prev, pq, BiayaWaktuTempuh(),
+                            FilterCatatMenitTetap<FilterTersediaKecualiEdge>{filter, hari, *menitTetap}, TanpaHeuristik(),
+                            HentiDiTujuan<string>{tujuan});
+    } else {
+        cariDenganKebijakan(AksesGraph{graph}, waktuKeMenit(waktu), dist, prev, pq, BiayaWaktuTempuh(), filter, TanpaHeuristik(),
+                            HentiDiTujuan<string>{tujuan});
+    }
+    return rekonstruksiRute(prev, tujuan);
+}
+
+// Fungsi untuk mencari rute alternatif (rute tercepat kedua)
+vector<string> cariRuteAlternatif(const Graph &graph, const string &asal, const string &tujuan, const string &waktu, int hari = 0) {
+    return cariRuteAlternatifDari(graph, asal, tujuan, waktu, hari, cariRuteTercepat(graph, asal, tujuan, waktu, hari));
+}
+
+// Ukuran satu halaman di file graf berhalaman
+const int UKURAN_HALAMAN = 4096;
+const int EDGE_PER_HALAMAN = UKURAN_HALAMAN / sizeof(EdgeKompak);
+
+// Fungsi untuk mengubah angkutan umum menjadi edge ringkas
+EdgeKompak keEdgeKompak(const AngkutanUmum &au, int tujuan, int angkutan) {
+    EdgeKompak edge;
+    edge.tujuan = tujuan;
+    edge.waktuTempuh = au.waktuTempuh;
+    edge.mulai = waktuKeMenit(au.jamMulaiOperasional);
+    edge.tutup = waktuKeMenit(au.jamTutupOperasional);
+    edge.frekuensi = au.frekuensi;
+    edge.hariMask = 0;
+    for (int i = 0; i < 7; ++i) {
+        if (au.hariOperasi.empty() || (static_cast<size_t>(i) < au.hariOperasi.size() && au.hariOperasi[i] == '1')) {
+            edge.hariMask |= 1 << i;
+        }
+    }
+    edge.angkutan = angkutan;
+    return edge;
+}
+
+// Fungsi untuk menambahkan edge ringkas ke akhir kolom-kolom edge graf kompak
+void tambahEdgeKompak(GraphKompak &graph, const EdgeKompak &edge) {
+    graph.tujuan.push_back(edge.tujuan);
+    graph.waktuTempuh.push_back(edge.waktuTempuh);
+    graph.mulai.push_back(edge.mulai);
+    graph.tutup.push_back(edge.tutup);
+    graph.frekuensi.push_back(edge.frekuensi);
+    graph.hariMask.push_back(edge.hariMask);
+    graph.angkutan.push_back(edge.angkutan);
+}
+
+// Fungsi untuk mengambil edge ke-i dari graf kompak dalam bentuk struct
+EdgeKompak ambilEdgeKompak(const GraphKompak &graph, int i) {
+    EdgeKompak edge;
+    edge.tujuan = graph.tujuan[i];
+    edge.waktuTempuh = graph.waktuTempuh[i];
+    edge.mulai = graph.mulai[i];
+    edge.tutup = graph.tutup[i];
+    edge.frekuensi = graph.frekuensi[i];
+    edge.hariMask = graph.hariMask[i];
+    edge.angkutan = graph.angkutan[i];
+    return edge;
+}
+
+// Fungsi untuk mengurutkan kota sesuai urutan std::map (urutan abjad), yaitu urutan bawaan Graph
+vector<string> urutanKotaAbjad(const Graph &graph) {
+    vector<string> urutan;
+    for (const auto &entry : graph.adjList) {
+        urutan.push_back(entry.first);
+    }
+    return urutan;
+}
+
+// Fungsi untuk mengurutkan ID kota dengan Reverse Cuthill-McKee. tetangga[u] berisi kota yang terhubung dengan u
+// (dua arah, tanpa u sendiri); ID awal dipakai sebagai pemecah seri sehingga hasilnya deterministik.
+vector<int> urutanCuthillMcKee(vector<vector<int>> &tetangga) {
+    for (auto &daftar : tetangga) {
+        sort(daftar.begin(), daftar.end());
+        daftar.erase(unique(daftar.begin(), daftar.end()), daftar.end());
+    }
+
+    // Kota diproses dari derajat terkecil agar setiap komponen dimulai dari kota "pinggiran"
+    vector<int> berdasarkanDerajat(tetangga.size());
+    for (size_t i = 0; i < tetangga.size(); ++i) {
+        berdasarkanDerajat[i] = static_cast<int>(i);
+    }
+    stable_sort(berdasarkanDerajat.begin(), berdasarkanDerajat.end(), [&](int a, int b) {
+        return tetangga[a].size() < tetangga[b].size();
+    });
+
+    vector<int> urutan;
+    vector<bool> dikunjungi(tetangga.size(), false);
+    for (int awal : berdasarkanDerajat) {
+        if (dikunjungi[awal]) continue;
+        dikunjungi[awal] = true;
+        size_t kepala = urutan.size();
+        urutan.push_back(awal);
+        while (kepala < urutan.size()) {
+            int kota = urutan[kepala++];
+            vector<int> baru;
+            for (int next : tetangga[kota]) {
+                if (!dikunjungi[next]) {
+                    dikunjungi[next] = true;
+                    baru.push_back(next);
+                }
+            }
+            stable_sort(baru.begin(), baru.end(), [&](int a, int b) {
+                return tetangga[a].size() < tetangga[b].size();
+            });
+            urutan.insert(urutan.end(), baru.begin(), baru.end());
+        }
+    }
+    reverse(urutan.begin(), urutan.end());
+    return urutan;
+}
+
+// Fungsi untuk mengurutkan kota dengan Reverse Cuthill-McKee (edge dianggap dua arah).
+// Kota yang bertetangga mendapat ID berdekatan sehingga edge dan jaraknya berada di cache line yang sama.
+vector<string> urutanKotaCuthillMcKee(const Graph &graph) {
+    vector<string> nama = urutanKotaAbjad(graph);
+    map<string, int> id;
+    for (size_t i = 0; i < nama.size(); ++i) {
+        id[nama[i]] = static_cast<int>(i);
+    }
+
+    vector<vector<int>> tetangga(nama.size());
+    for (const auto &entry : graph.adjList) {
+        for (const auto &neighbor : entry.second) {
+            int u = id[entry.first], v = id[neighbor.first];
+            if (u == v) continue;
+            tetangga[u].push_back(v);
+            tetangga[v].push_back(u);
+        }
+    }
+
+    vector<string> hasil;
+    for (int kota : urutanCuthillMcKee(tetangga)) {
+        hasil.push_back(nama[kota]);
+    }
+    return hasil;
+}
+
+// Fungsi untuk membangun graf kompak dengan ID kota sesuai urutan yang diberikan.
+// Adjacency dan tabel ID ditulis ulang; namaKota/idKota menyimpan pemetaan untuk input-output.
+GraphKompak bangunGraphKompak(const Graph &graph, const vector<string> &urutan) {
+    GraphKompak kompak;
+    kompak.namaKota = urutan;
+    for (size_t i = 0; i < urutan.size(); ++i) {
+        kompak.idKota[urutan[i]] = static_cast<int>(i);
+    }
+
+    map<string, int> idAngkutan;
+    for (const auto &kota : urutan) {
+        kompak.offset.push_back(static_cast<int>(kompak.tujuan.size()));
+        for (const auto &neighbor : graph.adjList.at(kota)) {
+            // Overlay feed gangguan ikut dibekukan: layanan batal dilewati, keterlambatan ditambahkan ke waktu tempuh
+            if (neighbor.second.dibatalkan) continue;
+            if (!idAngkutan.count(neighbor.second.nama)) {
+                idAngkutan[neighbor.second.nama] = static_cast<int>(kompak.namaAngkutan.size());
+                kompak.namaAngkutan.push_back(neighbor.second.nama);
+            }
+            EdgeKompak edge = keEdgeKompak(neighbor.second, kompak.idKota[neighbor.first], idAngkutan[neighbor.second.nama]);
+            edge.waktuTempuh += neighbor.second.keterlambatan;
+            tambahEdgeKompak(kompak, edge);
+        }
+    }
+    kompak.offset.push_back(static_cast<int>(kompak.tujuan.size()));
+    kompak.kedaluwarsa = false;
+    return kompak;
+}
+
+// Fungsi kernel relaksasi: mengevaluasi edge [awal, akhir) dari kota berjarak `jarak` yang dicapai pada `menit`
+// (waktu berangkat + jarak) dan menuliskan indeks edge serta jarak barunya ke idxBaik/jarakBaik hanya untuk edge yang tersedia dan memperbaiki dist.
+// Mengembalikan banyaknya edge yang ditulis. Pemanggil tetap membandingkan ulang dengan dist sebelum update
+// karena beberapa edge dalam satu kota bisa menuju kota tujuan yang sama.
+typedef int (*KernelRelaksasi)(const GraphKompak &graph, int awal, int akhir, int jarak, int menit, int hari,
+                               const int *dist, int *idxBaik, int *jarakBaik);
+
+// Versi skalar: satu edge per iterasi, dipakai di semua CPU dan untuk sisa edge versi SIMD
+int relaksasiEdgeSkalar(const GraphKompak &graph, int awal, int akhir, int jarak, int menit, int hari,
+                        const int *dist, int *idxBaik, int *jarakBaik) {
+    int jumlah = 0;
+    for (int i = awal; i < akhir; ++i) {
+        int weight = bobotEdgeKompak(ambilEdgeKompak(graph, i), menit, hari);
+        if (weight < 0) continue;
+        if (jarak + weight < dist[graph.tujuan[i]]) {
+            idxBaik[jumlah] = i;
+            jarakBaik[jumlah] = jarak + weight;
+            jumlah++;
+        }
+    }
+    return jumlah;
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PROJEKAN_AVX2
+#endif
+
+#ifdef PROJEKAN_AVX2
+// Versi AVX2: 8 edge sekaligus. Pembagian untuk waktu keberangkatan berikutnya memakai float karena AVX2
+// tidak punya pembagian integer; hasilnya tetap eksak karena menit dan frekuensi jauh di bawah 2^24.
+__attribute__((target("avx2")))
+int relaksasiEdgeAVX2(const GraphKompak &graph, int awal, int akhir, int jarak, int menit, int hari,
+                      const int *dist, int *idxBaik, int *jarakBaik) {
+    if (menit < 0) return 0;
+
+    const __m256i vMenit = _mm256_set1_epi32(menit);
+    const __m256i vJarak = _mm256_set1_epi32(jarak);
+    const bool cekHari = hari >= 1 && hari <= 7;
+    const __m256i vHari = _mm256_set1_epi32(cekHari ? 1 << (hari - 1) : 0);
+    const __m256i vNol = _mm256_setzero_si256();
+    const __m256i vSatu = _mm256_set1_epi32(1);
+
+    int jumlah = 0;
+    int i = awal;
+    for (; i + 8 <= akhir; i += 8) {
+        __m256i mulai = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&graph.mulai[i]));
+        __m256i tutup = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&graph.tutup[i]));
+        __m256i frekuensi = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&graph.frekuensi[i]));
+        __m256i tempuh = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&graph.waktuTempuh[i]));
+        __m256i hariMask = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&graph.hariMask[i]));
+        __m256i tujuan = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&graph.tujuan[i]));
+
+        // Tidak tersedia jika: mulai < 0, tidak beroperasi pada hari ini, atau keberangkatan berikutnya setelah tutup
+        __m256i tidakTersedia = _mm256_cmpgt_epi32(vNol, mulai);
+        if (cekHari) {
+            tidakTersedia = _mm256_or_si256(tidakTersedia, _mm256_cmpeq_epi32(_mm256_and_si256(hariMask, vHari), vNol));
+        }
+
+        // Keberangkatan berikutnya = mulai + ceil((menit - mulai) / frekuensi) * frekuensi untuk layanan berkala,
+        // paling awal jam mulai (penumpang yang tiba sebelum jam mulai menunggu keberangkatan pertama)
+        __m256i berkala = _mm256_cmpgt_epi32(frekuensi, vNol);
+        __m256i frekuensiAman = _mm256_blendv_epi8(vSatu, frekuensi, berkala);
+        __m256 hasilBagi = _mm256_ceil_ps(_mm256_div_ps(_mm256_cvtepi32_ps(_mm256_sub_epi32(vMenit, mulai)),
+                                                        _mm256_cvtepi32_ps(frekuensiAman)));
+        __m256i berangkat = _mm256_add_epi32(mulai, _mm256_mullo_epi32(_mm256_cvttps_epi32(hasilBagi), frekuensiAman));
+        berangkat = _mm256_max_epi32(_mm256_blendv_epi8(vMenit, berangkat, berkala), mulai);
+        tidakTersedia = _mm256_or_si256(tidakTersedia, _mm256_cmpgt_epi32(berangkat, tutup));
+
+        // Jarak kandidat dibandingkan dengan dist kota tujuan (dikumpulkan dengan gather)
+        __m256i kandidat = _mm256_add_epi32(vJarak, _mm256_add_epi32(_mm256_sub_epi32(berangkat, vMenit), tempuh));
+        __m256i distTujuan = _mm256_i32gather_epi32(dist, tujuan, 4);
+        __m256i lebihBaik = _mm256_andnot_si256(tidakTersedia, _mm256_cmpgt_epi32(distTujuan, kandidat));
+
+        int bit = _mm256_movemask_ps(_mm256_castsi256_ps(lebihBaik));
+        if (bit == 0) continue;
+
+        alignas(32) int nilaiKandidat[8];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(nilaiKandidat), kandidat);
+        while (bit) {
+            int lajur = __builtin_ctz(bit);
+            idxBaik[jumlah] = i + lajur;
+            jarakBaik[jumlah] = nilaiKandidat[lajur];
+            jumlah++;
+            bit &= bit - 1;
+        }
+    }
+
+    return jumlah + relaksasiEdgeSkalar(graph, i, akhir, jarak, menit, hari, dist, idxBaik + jumlah, jarakBaik + jumlah);
+}
+#endif
+
+// Fungsi untuk memilih kernel relaksasi terbaik yang didukung CPU saat program berjalan.
+// Dipanggil dari inisialisasi global (sebelum main), sehingga deteksi CPU harus diinisialisasi sendiri dulu.
+KernelRelaksasi pilihKernelRelaksasi() {
+#ifdef PROJEKAN_AVX2
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return relaksasiEdgeAVX2;
+    }
+#endif
+    return relaksasiEdgeSkalar;
+}
+
+// Kernel yang dipakai pencarian pada graf kompak, dipilih sekali saat program dimulai
+const KernelRelaksasi kernelRelaksasi = pilihKernelRelaksasi();
+
+// Akses graf kompak untuk inti pencarian. kernel dipakai untuk relaksasi dengan BiayaWaktuTempuh dan FilterTersedia;
+// kebijakan lain mengevaluasi edge satu per satu lewat untukSetiapEdge.
+struct AksesGraphKompak {
+    const GraphKompak &graph;
+    KernelRelaksasi kernel = kernelRelaksasi;
+    mutable vector<int> idxBaik{}, jarakBaik{}; // Hasil kernel untuk kota yang sedang diekspansi
+
+    template <typename F>
+    void untukSetiapEdge(int kota, const F &f) const {
+        for (int i = graph.offset[kota]; i < graph.offset[kota + 1]; ++i) {
+            f(graph.tujuan[i], ambilEdgeKompak(graph, i));
+        }
+    }
+    void diperbaiki(int) const {}
+};
+
+// Relaksasi pada graf kompak dengan kebijakan bawaan: filter dan biaya digabung di kernel relaksasi, yang hanya
+// mengembalikan edge yang memperbaiki dist, sehingga hanya edge tersebut yang diteruskan ke perbaiki
+template <typename Dist, typename Perbaiki>
+void relaksasiKota(const AksesGraphKompak &akses, const int &current, int jarak, int menit, const BiayaWaktuTempuh &,
+                   const FilterTersedia &filter, const Dist &dist, const Perbaiki &perbaiki) {
+    const GraphKompak &graph = akses.graph;
+    int derajat = graph.offset[current + 1] - graph.offset[current];
+    if (static_cast<int>(akses.idxBaik.size()) < derajat) {
+        akses.idxBaik.resize(derajat);
+        akses.jarakBaik.resize(derajat);
+    }
+    int jumlah = akses.kernel(graph, graph.offset[current], graph.offset[current + 1], jarak, menit, filter.hari, dist.data(),
+                              akses.idxBaik.data(), akses.jarakBaik.data());
+    for (int k = 0; k < jumlah; ++k) {
+        int i = akses.idxBaik[k];
+        perbaiki(graph.tujuan[i], ambilEdgeKompak(graph, i), akses.jarakBaik[k]);
+    }
+}
+
+// Fungsi untuk mencari rute tercepat pada graf kompak (hasil sama dengan cariRuteTercepat)
+vector<string> cariRuteTercepatKompak(const GraphKompak &graph, const string &asal, const string &tujuan, const string &waktu, int hari = 0,
+                                      KernelRelaksasi kernel = kernelRelaksasi) {
+    auto itAsal = graph.idKota.find(asal);
+    auto itTujuan = graph.idKota.find(tujuan);
+    if (itAsal == graph.idKota.end() || itTujuan == graph.idKota.end()) {
+        return {}; // Kota asal atau tujuan tidak ada di dalam graf
+    }
+
+    int idTujuan = itTujuan->second;
+    vector<int> dist, prev;
+    AntrianDijkstraId pq;
+    mulaiPencarian(graph.namaKota.size(), itAsal->second, dist, prev, pq);
+    cariDenganKebijakan(AksesGraphKompak{graph, kernel}, waktuKeMenit(waktu), dist, prev, pq, BiayaWaktuTempuh(), FilterTersedia{hari},
+                        TanpaHeuristik(), HentiDiTujuan<int>{idTujuan});
+    return rekonstruksiRute(prev, graph.namaKota, idTujuan);
+}
+
+// Fungsi untuk mencari kota terjangkau pada graf kompak (hasil sama dengan cariKotaTerjangkau).
+// Jarak disimpan di array per ID kota, sehingga tidak ada map berisi semua kota yang dibuat untuk setiap asal.
+vector<pair<string, int>> cariKotaTerjangkauKompak(const GraphKompak &graph, const string &asal, const string &waktu, int batasMenit,
+                                                   int hari = 0) {
+    vector<pair<string, int>> hasil;
+    auto itAsal = graph.idKota.find(asal);
+    if (itAsal == graph.idKota.end()) {
+        return hasil; // Kota asal tidak ada di dalam graf
+    }
+
+    vector<int> dist, prev;
+    AntrianDijkstraId pq;
+    mulaiPencarian(graph.namaKota.size(), itAsal->second, dist, prev, pq);
+    cariDenganKebijakan(AksesGraphKompak{graph}, waktuKeMenit(waktu), dist, prev, pq, BiayaWaktuTempuh(), FilterTersedia{hari},
+                        TanpaHeuristik(), HentiBatasWaktu{batasMenit});
+
+    for (size_t i = 0; i < dist.size(); ++i) {
+        if (dist[i] <= batasMenit) {
+            hasil.push_back({graph.namaKota[i], dist[i]});
+        }
+    }
+    sort(hasil.begin(), hasil.end(), [](const pair<string, int> &a, const pair<string, int> &b) {
+        return a.second != b.second ? a.second < b.second : a.first < b.first;
+    });
+    return hasil;
+}
+
+// Fungsi untuk menjalankan pencarian kota terjangkau dari banyak kota asal sekaligus secara paralel.
+// Graf kompak hanya dibaca, sehingga setiap thread dapat menelusurinya tanpa penguncian. Thread diambil dari kumpulan
+// bersama, sehingga panggilan berulang tidak membayar biaya membuat dan menggabungkan thread.
+vector<vector<pair<string, int>>> cariKotaTerjangkauBanyak(const GraphKompak &graph, const vector<string> &daftarAsal, const string &waktu,
+                                                          int batasMenit, int hari = 0) {
+    vector<vector<pair<string, int>>> hasil(daftarAsal.size());
+
+    // Setiap tugas menangani satu kota asal dan menulis ke slot hasilnya sendiri
+    jalankanParalel(daftarAsal.size(), [&](size_t i) {
+        hasil[i] = cariKotaTerjangkauKompak(graph, daftarAsal[i], waktu, batasMenit, hari);
+    });
+    return hasil;
+}
+
+// Fungsi untuk memastikan graf kompak sesuai dengan graf saat ini. Graf kompak dibangun ulang (urutan Cuthill-McKee)
+// hanya jika ditandai kedaluwarsa oleh perubahan jadwal, kota, atau feed gangguan, dan baru saat dibutuhkan.
+void siapkanGraphKompak(GraphKompak &kompak, const Graph &graph) {
+    if (!kompak.kedaluwarsa) return;
+    kompak = bangunGraphKompak(graph, urutanKotaCuthillMcKee(graph));
+}
+
+// Fungsi bantu untuk menulis/membaca integer dan string dalam format biner
+void tulisInt(ofstream &file, int nilai) {
+    file.write(reinterpret_cast<const char *>(&nilai), sizeof(nilai));
+}
+
+void tulisString(ofstream &file, const string &teks) {
+    tulisInt(file, static_cast<int>(teks.size()));
+    file.write(teks.data(), teks.size());
+}
+
+int bacaInt(ifstream &file) {
+    int nilai = 0;
+    file.read(reinterpret_cast<char *>(&nilai), sizeof(nilai));
+    return nilai;
+}
+
+string bacaString(ifstream &file) {
+    string teks(max(bacaInt(file), 0), ' ');
+    file.read(&teks[0], teks.size());
+    return teks;
+}
+
+// Fungsi untuk menghitung sidik jari sebuah teks (FNV-1a 64 bit)
+unsigned long long sidikJariTeks(const string &teks) {
+    unsigned long long hash = 1469598103934665603ULL;
+    for (unsigned char c : teks) {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Fungsi untuk menghitung sidik jari satu layanan, termasuk overlay gangguan yang ikut dibekukan ke file halaman
+unsigned long long sidikJariLayanan(const AngkutanUmum &au) {
+    return sidikJariTeks(au.nama + " " + au.kotaAsal + " " + au.kotaTujuan + " " + au.jamMulaiOperasional + " " +
+                         au.jamTutupOperasional + " " + to_string(au.waktuTempuh) + " " + to_string(au.frekuensi) + " " +
+                         au.hariOperasi + " " + to_string(au.keterlambatan) + " " + (au.dibatalkan ? "1" : "0"));
+}
+
+// Fungsi untuk menghitung sidik jari graf yang disimpan di file halaman. Sidik jari kota dan layanan dijumlahkan
+// sehingga tidak bergantung pada urutan, dan pemuat yang membaca file data baris demi baris mendapat nilai yang sama.
+unsigned long long sidikJariHalaman(const Graph &graph) {
+    unsigned long long hash = 0;
+    for (const auto &entry : graph.adjList) {
+        hash += sidikJariTeks("KOTA " + entry.first);
+        for (const auto &neighbor : entry.second) {
+            hash += sidikJariLayanan(neighbor.second);
+        }
+    }
+    return hash;
+}
+
+// Fungsi untuk menulis kepala file berhalaman: "GRAFHAL2", sidik jari, daftar nama kota, daftar nama angkutan,
+// direktori kota, dan jumlah edge. Mengembalikan offset halaman pertama (kelipatan UKURAN_HALAMAN).
+long tulisKepalaPenyimpananGraf(ofstream &file, unsigned long long sidikJari, const vector<string> &namaKota,
+                                const vector<string> &namaAngkutan, const vector<DirektoriKota> &direktori, int jumlahEdge) {
+    file.write("GRAFHAL2", 8);
+    file.write(reinterpret_cast<const char *>(&sidikJari), sizeof(sidikJari));
+    tulisInt(file, static_cast<int>(namaKota.size()));
+    for (const auto &kota : namaKota) tulisString(file, kota);
+    tulisInt(file, static_cast<int>(namaAngkutan.size()));
+    for (const auto &nama : namaAngkutan) tulisString(file, nama);
+    for (const auto &dir : direktori) {
+        tulisInt(file, dir.edgeAwal);
+        tulisInt(file, dir.jumlahEdge);
+    }
+    tulisInt(file, jumlahEdge);
+
+    // Halaman dimulai pada kelipatan UKURAN_HALAMAN agar satu halaman = satu pembacaan blok
+    long posisi = static_cast<long>(file.tellp());
+    long posisiHalamanPertama = (posisi + UKURAN_HALAMAN - 1) / UKURAN_HALAMAN * UKURAN_HALAMAN;
+    string pengisi(posisiHalamanPertama - posisi, '\0');
+    file.write(pengisi.data(), pengisi.size());
+    return posisiHalamanPertama;
+}
+
+// Fungsi untuk menulis graf ke file berhalaman (format lihat tulisKepalaPenyimpananGraf), diikuti halaman edge
+// berukuran UKURAN_HALAMAN.
+bool bangunPenyimpananGraf(const Graph &graph, const string &namaFile) {
+    ofstream file(namaFile, ios::binary);
+    if (!file.is_open()) {
+        cerr << "Gagal membuka file " << namaFile << " untuk penulisan." << endl;
+        return false;
+    }
+
+    // Kota diurutkan dengan Cuthill-McKee sehingga edge kota yang bertetangga berada di halaman yang sama
+    GraphKompak kompak = bangunGraphKompak(graph, urutanKotaCuthillMcKee(graph));
+    vector<EdgeKompak> edges;
+    for (size_t i = 0; i < kompak.tujuan.size(); ++i) {
+        edges.push_back(ambilEdgeKompak(kompak, static_cast<int>(i)));
+    }
+    vector<DirektoriKota> direktori;
+    for (size_t i = 0; i < kompak.namaKota.size(); ++i) {
+        direktori.push_back({kompak.offset[i], kompak.offset[i + 1] - kompak.offset[i]});
+    }
+    tulisKepalaPenyimpananGraf(file, sidikJariHalaman(graph), kompak.namaKota, kompak.namaAngkutan, direktori,
+                               static_cast<int>(edges.size()));
+
+    for (size_t i = 0; i < edges.size(); i += EDGE_PER_HALAMAN) {
+        vector<char> halaman(UKURAN_HALAMAN, 0);
+        size_t jumlah = min(edges.size() - i, static_cast<size_t>(EDGE_PER_HALAMAN));
+        memcpy(halaman.data(), &edges[i], jumlah * sizeof(EdgeKompak));
+        file.write(halaman.data(), halaman.size());
+    }
+
+    file.close();
+    return true;
+}
+
+// Fungsi untuk menulis file berhalaman langsung dari file data angkutan umum tanpa membangun Graph.
+// File data dibaca dua kali baris demi baris: pertama untuk ID kota, nama angkutan, dan urutan Cuthill-McKee
+// (cukup pasangan ID kota per edge di memori), kedua untuk menulis setiap edge ke slotnya di halaman.
+// Hasilnya setara dengan bangunPenyimpananGraf pada graf yang dibaca program dari file yang sama.
+bool bangunPenyimpananGrafDariFile(const string &namaFileAngkutan, const string &namaFileKota, const string &namaFile) {
+    ifstream data(namaFileAngkutan);
+    if (!data.is_open()) {
+        cerr << "Gagal membuka file " << namaFileAngkutan << "." << endl;
+        return false;
+    }
+
+    // Tahap 1: kota dari daftar kota terdaftar dan dari setiap edge, seperti bacaDaftarKota + tambahAngkutanUmumKeGraf
+    map<string, int> idKota;
+    ifstream fileKota(namaFileKota);
+    string line;
+    while (getline(fileKota, line)) {
+        idKota.insert({line, 0});
+    }
+    vector<pair<string, string>> ujungEdge; // Dipakai sementara sebelum ID final diketahui
+    vector<pair<int, int>> edgeId;
+    set<string> namaAngkutanSet;
+    unsigned long long sidikJari = 0;
+    while (getline(data, line)) {
+        AngkutanUmum au = bacaBarisAngkutanUmum(line);
+        idKota.insert({au.kotaAsal, 0});
+        idKota.insert({au.kotaTujuan, 0});
+        namaAngkutanSet.insert(au.nama);
+        sidikJari += sidikJariLayanan(au);
+        ujungEdge.push_back({au.kotaAsal, au.kotaTujuan});
+    }
+
+    // ID awal mengikuti urutan abjad seperti urutanKotaCuthillMcKee pada Graph
+    vector<string> namaAbjad;
+    for (auto &entry : idKota) {
+        entry.second = static_cast<int>(namaAbjad.size());
+        namaAbjad.push_back(entry.first);
+        sidikJari += sidikJariTeks("KOTA " + entry.first);
+    }
+    vector<vector<int>> tetangga(namaAbjad.size());
+    for (const auto &ujung : ujungEdge) {
+        int u = idKota[ujung.first], v = idKota[ujung.second];
+        edgeId.push_back({u, v});
+        if (u == v) continue;
+        tetangga[u].push_back(v);
+        tetangga[v].push_back(u);
+    }
+    vector<pair<string, string>>().swap(ujungEdge);
+
+    vector<int> urutan = urutanCuthillMcKee(tetangga);
+    vector<vector<int>>().swap(tetangga);
+    vector<int> idBaru(urutan.size());
+    vector<string> namaKota;
+    for (size_t i = 0; i < urutan.size(); ++i) {
+        idBaru[urutan[i]] = static_cast<int>(i);
+        namaKota.push_back(namaAbjad[urutan[i]]);
+    }
+
+    vector<DirektoriKota> direktori(namaKota.size(), {0, 0});
+    for (const auto &edge : edgeId) {
+        direktori[idBaru[edge.first]].jumlahEdge++;
+    }
+    for (size_t i = 1; i < direktori.size(); ++i) {
+        direktori[i].edgeAwal = direktori[i - 1].edgeAwal + direktori[i - 1].jumlahEdge;
+    }
+    vector<string> namaAngkutan(namaAngkutanSet.begin(), namaAngkutanSet.end());
+    map<string, int> idAngkutan;
+    for (size_t i = 0; i < namaAngkutan.size(); ++i) {
+        idAngkutan[namaAngkutan[i]] = static_cast<int>(i);
+    }
+
+    ofstream file(namaFile, ios::binary);
+    if (!file.is_open()) {
+        cerr << "Gagal membuka file " << namaFile << " untuk penulisan." << endl;
+        return false;
+    }
+    int jumlahEdge = static_cast<int>(edgeId.size());
+    long posisiHalamanPertama = tulisKepalaPenyimpananGraf(file, sidikJari, namaKota, namaAngkutan, direktori, jumlahEdge);
+    vector<char> kosong(UKURAN_HALAMAN, 0);
+    for (int i = 0; i < jumlahEdge; i += EDGE_PER_HALAMAN) {
+        file.write(kosong.data(), kosong.size());
+    }
+
+    // Tahap 2: edge ditulis ke slotnya; urutan edge dalam satu kota sama dengan urutan baris di file data
+    vector<int> terisi(namaKota.size(), 0);
+    data.clear();
+    data.seekg(0);
+    for (size_t i = 0; getline(data, line); ++i) {
+        AngkutanUmum au = bacaBarisAngkutanUmum(line);
+        int asal = idBaru[edgeId[i].first];
+        int slot = direktori[asal].edgeAwal + terisi[asal]++;
+        EdgeKompak edge = keEdgeKompak(au, idBaru[edgeId[i].second], idAngkutan[au.nama]);
+        file.seekp(posisiHalamanPertama + static_cast<long>(slot / EDGE_PER_HALAMAN) * UKURAN_HALAMAN +
+                   static_cast<long>(slot % EDGE_PER_HALAMAN) * sizeof(EdgeKompak));
+        file.write(reinterpret_cast<const char *>(&edge), sizeof(edge));
+    }
+
+    file.close();
+    return static_cast<bool>(file);
+}
+
+// Fungsi untuk mengatur jumlah frame buffer pool; halaman yang sudah dimuat tetap dipakai jika jumlahnya sama
+void aturBufferPool(PenyimpananGrafBerhalaman &store, int jumlahFrame) {
+    jumlahFrame = max(jumlahFrame, 1);
+    if (static_cast<int>(store.frame.size()) == jumlahFrame) return;
+    store.frame.assign(jumlahFrame, vector<EdgeKompak>(EDGE_PER_HALAMAN));
+    store.halamanDiFrame.assign(jumlahFrame, -1);
+    store.bitReferensi.assign(jumlahFrame, false);
+    store.frameDariHalaman.assign(store.jumlahHalaman, -1);
+    store.jarumClock = 0;
+}
+
+// Fungsi untuk membuka file graf berhalaman dengan buffer pool sebanyak jumlahFrame halaman.
+// Isi store sebelumnya diganti seluruhnya.
+bool bukaPenyimpananGraf(PenyimpananGrafBerhalaman &store, const string &namaFile, int jumlahFrame) {
+    store = PenyimpananGrafBerhalaman();
+    store.file.open(namaFile, ios::binary);
+    char magic[8];
+    if (!store.file.is_open() || !store.file.read(magic, 8) || string(magic, 8) != "GRAFHAL2") {
+        return false;
+    }
+
+    store.file.read(reinterpret_cast<char *>(&store.sidikJari), sizeof(store.sidikJari));
+    int jumlahKota = bacaInt(store.file);
+    for (int i = 0; i < jumlahKota; ++i) {
+        store.namaKota.push_back(bacaString(store.file));
+        store.idKota[store.namaKota.back()] = i;
+    }
+    int jumlahAngkutan = bacaInt(store.file);
+    for (int i = 0; i < jumlahAngkutan; ++i) {
+        store.namaAngkutan.push_back(bacaString(store.file));
+    }
+    for (int i = 0; i < jumlahKota; ++i) {
+        DirektoriKota dir;
+        dir.edgeAwal = bacaInt(store.file);
+        dir.jumlahEdge = bacaInt(store.file);
+        store.direktori.push_back(dir);
+    }
+    int jumlahEdge = bacaInt(store.file);
+    if (!store.file) {
+        return false;
+    }
+
+    long posisi = static_cast<long>(store.file.tellg());
+    store.posisiHalamanPertama = (posisi + UKURAN_HALAMAN - 1) / UKURAN_HALAMAN * UKURAN_HALAMAN;
+    store.jumlahHalaman = (jumlahEdge + EDGE_PER_HALAMAN - 1) / EDGE_PER_HALAMAN;
+    aturBufferPool(store, jumlahFrame);
+    store.kedaluwarsa = false;
+    return true;
+}
+
+// Fungsi untuk memastikan store berisi graf saat ini: store yang masih sesuai dipakai apa adanya (buffer pool tetap
+// hangat), file di disk dibuka ulang jika sidik jarinya cocok, dan baru dibangun ulang dari graf jika tidak.
+// File dibangun dari graf yang sudah dimuat di memori, sehingga menu 11 adalah demo penyimpanan berhalaman, bukan
+// jalur untuk jaringan yang lebih besar dari RAM.
+// Mengembalikan false jika file tidak dapat ditulis atau dibaca.
+bool siapkanPenyimpananGraf(PenyimpananGrafBerhalaman &store, const Graph &graph, const string &namaFile, int jumlahFrame) {
+    if (!store.kedaluwarsa) {
+        aturBufferPool(store, jumlahFrame);
+        return true;
+    }
+
+    unsigned long long sidikJari = sidikJariHalaman(graph);
+    if (bukaPenyimpananGraf(store, namaFile, jumlahFrame) && store.sidikJari == sidikJari) {
+        return true;
+    }
+    cout << "File graf berhalaman dibangun ulang dari data terbaru.\n";
+    if (!bangunPenyimpananGraf(graph, namaFile) || !bukaPenyimpananGraf(store, namaFile, jumlahFrame)) {
+        cerr << "Gagal membuka file graf berhalaman " << namaFile << "." << endl;
+        store.kedaluwarsa = true;
+        return false;
+    }
+    return true;
+}
+
+// Fungsi untuk memilih frame korban dengan algoritma CLOCK (second chance)
+size_t pilihFrameKorban(PenyimpananGrafBerhalaman &store) {
+    while (true) {
+        size_t kandidat = store.jarumClock;
+        store.jarumClock = (store.jarumClock + 1) % store.frame.size();
+        if (store.halamanDiFrame[kandidat] == -1 || !store.bitReferensi[kandidat]) {
+            return kandidat;
+        }
+        store.bitReferensi[kandidat] = false;
+    }
+}
+
+// Fungsi untuk memuat halaman dari disk ke buffer pool, mengembalikan indeks frame
+size_t muatHalaman(PenyimpananGrafBerhalaman &store, int halaman) {
+    size_t frame = pilihFrameKorban(store);
+    if (store.halamanDiFrame[frame] != -1) {
+        store.frameDariHalaman[store.halamanDiFrame[frame]] = -1;
+    }
+
+    store.file.clear();
+    store.file.seekg(store.posisiHalamanPertama + static_cast<long>(halaman) * UKURAN_HALAMAN);
+    store.file.read(reinterpret_cast<char *>(store.frame[frame].data()), EDGE_PER_HALAMAN * sizeof(EdgeKompak));
+
+    store.halamanDiFrame[frame] = halaman;
+    store.frameDariHalaman[halaman] = static_cast<int>(frame);
+    store.bitReferensi[frame] = true;
+    return frame;
+}
+
+// Fungsi untuk mengambil halaman edge dari buffer pool (dibaca dari disk jika belum ada)
+const vector<EdgeKompak> &ambilHalaman(PenyimpananGrafBerhalaman &store, int halaman) {
+    store.statistik.akses++;
+    int frame = store.frameDariHalaman[halaman];
+    if (frame != -1) {
+        store.statistik.hit++;
+        store.bitReferensi[frame] = true;
+        return store.frame[frame];
+    }
+    store.statistik.pageFault++;
+    return store.frame[muatHalaman(store, halaman)];
+}
+
+// Fungsi untuk membaca lebih awal halaman pertama milik sebuah kota jika belum ada di buffer pool
+void prefetchHalamanKota(PenyimpananGrafBerhalaman &store, int kota) {
+    const DirektoriKota &dir = store.direktori[kota];
+    if (dir.jumlahEdge == 0) return;
+    int halaman = dir.edgeAwal / EDGE_PER_HALAMAN;
+    if (store.frameDariHalaman[halaman] == -1) {
+        store.statistik.prefetch++;
+        muatHalaman(store, halaman);
+    }
+}
+
+// Akses graf berhalaman untuk inti pencarian: edge sebuah kota disalin dari buffer pool sebelum direlaksasi, karena
+// prefetch saat relaksasi bisa mengganti frame yang sedang dibaca
+struct AksesGraphBerhalaman {
+    PenyimpananGrafBerhalaman &store;
+    bool prefetch;
+    mutable vector<EdgeKompak> edges{}; // Salinan edge kota yang sedang diekspansi
+
+    template <typename F>
+    void untukSetiapEdge(int kota, const F &f) const {
+        // Edge sebuah kota bisa melintasi dua halaman; setiap halaman diminta sekali lalu semua edge di dalamnya disalin
+        const DirektoriKota &dir = store.direktori[kota];
+        edges.clear();
+        int akhir = dir.edgeAwal + dir.jumlahEdge;
+        for (int i = dir.edgeAwal; i < akhir;) {
+            int halaman = i / EDGE_PER_HALAMAN;
+            int batas = min(akhir, (halaman + 1) * EDGE_PER_HALAMAN);
+            const vector<EdgeKompak> &isi = ambilHalaman(store, halaman);
+            edges.insert(edges.end(), isi.begin() + i % EDGE_PER_HALAMAN, isi.begin() + (batas - halaman * EDGE_PER_HALAMAN));
+            i = batas;
+        }
+        for (const auto &edge : edges) {
+            f(edge.tujuan, edge);
+        }
+    }
+    void diperbaiki(int kota) const {
+        if (prefetch) {
+            prefetchHalamanKota(store, kota);
+        }
+    }
+};
+
+// Fungsi untuk mencari rute tercepat langsung dari penyimpanan graf berhalaman.
+// Statistik buffer pool di-reset di awal sehingga setelah pemanggilan berisi angka untuk query ini saja.
+vector<string> cariRuteTercepatBerhalaman(PenyimpananGrafBerhalaman &store, const string &asal, const string &tujuan,
+                                          const string &waktu, int hari = 0, bool prefetch = true) {
+    store.statistik = StatistikHalaman();
+    if (!store.idKota.count(asal) || !store.idKota.count(tujuan)) {
+        return {}; // Kota asal atau tujuan tidak ada di dalam graf
+    }
+
+    int idTujuan = store.idKota[tujuan];
+    vector<int> dist, prev;
+    AntrianDijkstraId pq;
+    mulaiPencarian(store.namaKota.size(), store.idKota[asal], dist, prev, pq);
+    cariDenganKebijakan(AksesGraphBerhalaman{store, prefetch}, waktuKeMenit(waktu), dist, prev, pq, BiayaWaktuTempuh(),
+                        FilterTersedia{hari}, TanpaHeuristik(), HentiDiTujuan<int>{idTujuan});
+    return rekonstruksiRute(prev, store.namaKota, idTujuan);
+}
+
+// Fungsi untuk menampilkan statistik buffer pool dari query terakhir
+void tampilkanStatistikHalaman(const StatistikHalaman &statistik) {
+    double hitRate = statistik.akses == 0 ? 0.0 : 100.0 * statistik.hit / statistik.akses;
+    cout << "Statistik halaman: " << statistik.akses << " akses, " << statistik.hit << " hit, "
+         << statistik.pageFault << " page fault, " << statistik.prefetch << " prefetch (hit rate " << hitRate << "%)\n";
+    cout << "Halaman dibaca dari disk: " << statistik.pageFault + statistik.prefetch << " (page fault + prefetch)\n";
+}
+
+// Fungsi untuk membagi kota ke dalam beberapa region dengan edge potong (edge antar region) sesedikit mungkin.
+// Awalnya urutan Cuthill-McKee dipotong menjadi blok berukuran sama (kota bertetangga sudah berdekatan),
+// lalu setiap kota dipindahkan ke region tetangga yang paling banyak terhubung dengannya selama region tetap seimbang.
+map<string, int> partisiKota(const Graph &graph, int jumlahRegion) {
+    map<string, int> region;
+    vector<string> urutan = urutanKotaCuthillMcKee(graph);
+    if (urutan.empty() || jumlahRegion < 1) return region;
+    jumlahRegion = min<int>(jumlahRegion, urutan.size());
+
+    // Batas blok di i * jumlahRegion / n, sehingga ukuran blok berbeda paling banyak satu dan tidak ada region kosong
+    size_t n = urutan.size();
+    vector<int> ukuran(jumlahRegion, 0);
+    for (size_t i = 0; i < n; ++i) {
+        int r = static_cast<int>(i * jumlahRegion / n);
+        region[urutan[i]] = r;
+        ukuran[r]++;
+    }
+
+    // Edge dianggap dua arah untuk menghitung keterhubungan antar kota
+    map<string, vector<string>> tetangga;
+    for (const auto &entry : graph.adjList) {
+        for (const auto &neighbor : entry.second) {
+            if (neighbor.first == entry.first) continue;
+            tetangga[entry.first].push_back(neighbor.first);
+            tetangga[neighbor.first].push_back(entry.first);
+        }
+    }
+
+    // Toleransi ketidakseimbangan 5% dari ukuran blok
+    int ukuranBlok = static_cast<int>((n + jumlahRegion - 1) / jumlahRegion);
+    int batasAtas = ukuranBlok + ukuranBlok / 20 + 1;
+    int batasBawah = max(1, static_cast<int>(n / jumlahRegion) - ukuranBlok / 20 - 1);
+    for (int putaran = 0; putaran < 10; ++putaran) {
+        int dipindah = 0;
+        for (const auto &kota : urutan) {
+            int asal = region[kota];
+            vector<int> hitung(jumlahRegion, 0);
+            for (const auto &next : tetangga[kota]) {
+                hitung[region[next]]++;
+            }
+            int terbaik = asal;
+            for (int r = 0; r < jumlahRegion; ++r) {
+                if (hitung[r] > hitung[terbaik] && ukuran[r] < batasAtas) terbaik = r;
+            }
+            if (terbaik != asal && ukuran[asal] > batasBawah) {
+                region[kota] = terbaik;
+                ukuran[asal]--;
+                ukuran[terbaik]++;
+                dipindah++;
+            }
+        }
+        if (dipindah == 0) break;
+    }
+    return region;
+}
+
+// Fungsi untuk menghitung banyaknya edge yang menghubungkan dua region berbeda
+int hitungEdgePotong(const Graph &graph, const map<string, int> &region) {
+    int jumlah = 0;
+    for (const auto &entry : graph.adjList) {
+        for (const auto &neighbor : entry.second) {
+            if (region.at(entry.first) != region.at(neighbor.first)) jumlah++;
+        }
+    }
+    return jumlah;
+}
+
+// Fungsi untuk memperkirakan memori yang dipakai sebuah graf (byte), untuk membandingkan shard dengan graf utuh
+size_t perkiraanMemoriGraf(const Graph &graph) {
+    // Perkiraan overhead satu node std::map dan satu string (header + isi)
+    const size_t NODE_MAP = 48;
+    size_t total = 0;
+    for (const auto &entry : graph.adjList) {
+        total += NODE_MAP + sizeof(entry) + entry.first.capacity();
+        total += entry.second.capacity() * sizeof(pair<string, AngkutanUmum>);
+        for (const auto &neighbor : entry.second) {
+            const AngkutanUmum &au = neighbor.second;
+            total += neighbor.first.capacity() + au.nama.capacity() + au.kotaAsal.capacity() + au.kotaTujuan.capacity() +
+                     au.jamMulaiOperasional.capacity() + au.jamTutupOperasional.capacity() + au.hariOperasi.capacity();
+        }
+    }
+    return total;
+}
+
+#ifdef PROJEKAN_SHARD
+// Struct untuk satu region yang dilayani oleh proses shard
+struct RegionShard {
+    int id;
+    Graph sub; // Kota region ini beserta semua edge keluarnya; kota region lain hanya muncul sebagai tujuan edge potong
+    vector<string> kotaLuar; // Kota region lain yang menjadi tujuan edge potong dari region ini
+
+    // Status pencarian yang sedang berjalan; dilanjutkan sedikit demi sedikit oleh perintah MAJU dari koordinator
+    int menitAwal = -1;
+    int hari = 0;
+    string tujuan;
+    map<string, int> dist;
+    map<string, string> prev; // Kota sebelumnya; untuk kota pintu masuk region bisa berupa kota region lain
+    map<string, int> dilaporkan; // Kota luar -> jarak terakhir yang sudah dilaporkan ke koordinator
+    AntrianDijkstra pq;
+};
+
+// Struct untuk koneksi koordinator ke satu proses shard
+struct KoneksiShard {
+    pid_t pid = -1;
+    int fd = -1; // Ujung socket milik koordinator
+    string buffer; // Sisa data yang sudah diterima tetapi belum menjadi satu baris utuh
+};
+
+// Struct untuk koordinator yang menggabungkan pencarian lokal dari semua shard
+struct KoordinatorShard {
+    map<string, int> region; // Kota -> region
+    vector<KoneksiShard> shard;
+    int bobotPotongMinimum = 0; // Waktu tempuh tersingkat edge potong; batas seberapa jauh shard boleh maju dalam satu putaran
+    long pesanTerkirim = 0; // Jumlah perintah yang dikirim ke shard (round trip)
+};
+
+#ifdef MSG_NOSIGNAL
+const int FLAG_KIRIM_SHARD = MSG_NOSIGNAL; // Shard yang mati tidak boleh menghentikan koordinator lewat SIGPIPE
+#else
+const int FLAG_KIRIM_SHARD = 0;
+#endif
+
+// Fungsi untuk mengirim satu baris teks melalui socket
+bool kirimBaris(int fd, const string &baris) {
+    string data = baris + "\n";
+    size_t terkirim = 0;
+    while (terkirim < data.size()) {
+        ssize_t n = send(fd, data.data() + terkirim, data.size() - terkirim, FLAG_KIRIM_SHARD);
+        if (n <= 0) return false;
+        terkirim += n;
+    }
+    return true;
+}
+
+// Fungsi untuk menerima satu baris teks dari socket; data berlebih disimpan di buffer untuk panggilan berikutnya
+bool terimaBaris(int fd, string &buffer, string &baris) {
+    size_t posisi;
+    while ((posisi = buffer.find('\n')) == string::npos) {
+        char data[4096];
+        ssize_t n = recv(fd, data, sizeof(data), 0);
+        if (n <= 0) return false;
+        buffer.append(data, n);
+    }
+    baris = buffer.substr(0, posisi);
+    buffer.erase(0, posisi + 1);
+    return true;
+}
+
+// Fungsi untuk memeriksa bahwa tidak ada lagi teks tersisa di baris protokol shard yang sedang diurai
+bool akhirBaris(stringstream &ss) {
+    string sisa;
+    return !(ss >> sisa);
+}
+
+// Fungsi untuk membangun region shard dari graf utuh berdasarkan hasil partisi
+RegionShard bangunRegionShard(const Graph &graph, const map<string, int> &region, int id) {
+    RegionShard shard;
+    shard.id = id;
+    set<string> luar;
+    for (const auto &entry : graph.adjList) {
+        if (region.at(entry.first) != id) continue;
+        shard.sub.adjList[entry.first];
+        for (const auto &neighbor : entry.second) {
+            tambahAngkutanUmumKeGraf(shard.sub, neighbor.second);
+            if (region.at(neighbor.first) != id) luar.insert(neighbor.first);
+        }
+    }
+    shard.kotaLuar.assign(luar.begin(), luar.end());
+    return shard;
+}
+
+// Fungsi untuk mengambil jarak terkecil yang masih menunggu di antrian shard, -1 jika antrian kosong.
+// Entri usang dibuang lebih dulu agar koordinator tidak menunggu kota yang sudah final.
+int jarakAntrianShard(RegionShard &shard) {
+    while (!shard.pq.empty() && shard.pq.top().first > shard.dist[shard.pq.top().second]) {
+        shard.pq.pop();
+    }
+    return shard.pq.empty() ? -1 : shard.pq.top().first;
+}
+
+// Fungsi untuk melayani perintah koordinator di dalam proses shard sampai menerima SELESAI. Setiap balasan diakhiri baris ".".
+// Satu query adalah satu Dijkstra berbasis waktu tiba yang tersebar di semua shard; koordinator menentukan sampai
+// jarak berapa setiap shard boleh maju agar tidak ada kota yang difinalkan sebelum kiriman dari region lain tiba.
+//   MULAI <asal> <menit> <hari> <tujuan> -> memulai pencarian baru (kosong)
+//   MAJU <batas> <n> + n baris "<kota> <jarak> <dari>"
+//                                        -> menerapkan kiriman dari region lain lalu mengekspansi kota berjarak <= batas;
+//                                           membalas "<kota luar> <jarak> <dari>" untuk kota luar yang membaik,
+//                                           "TUJUAN <jarak>" jika tujuan ada di region ini, dan "MIN <jarak>" (-1 = habis)
+//   RUTE <kota>                          -> kota sebelum potongan rute (atau "-" jika potongan dimulai dari asal),
+//                                           lalu kota-kota potongan rute di region ini sampai <kota>, satu per baris
+//   MEMORI                               -> "<kota> <edge> <byte graf> <byte status pencarian>"
+void layaniShard(int fd, RegionShard &shard, const map<string, int> &region) {
+    const int TAK_HINGGA = numeric_limits<int>::max();
+    string buffer, baris;
+    while (terimaBaris(fd, buffer, baris)) {
+        stringstream ss(baris);
+        string perintah;
+        ss >> perintah;
+        vector<string> balasan;
+
+        if (perintah == "MULAI") {
+            string asal;
+            ss >> asal >> shard.menitAwal >> shard.hari >> shard.tujuan;
+            if (!ss || !region.count(asal)) shard.menitAwal = -1; // Perintah rusak: pencarian kosong
+            // Hanya shard pemilik kota asal yang memulai dengan kota asal di antrian
+            bool pemilikAsal = shard.menitAwal >= 0 && region.at(asal) == shard.id;
+            mulaiPencarian(shard.sub, pemilikAsal ? asal : "", shard.dist, shard.prev, shard.pq);
+            shard.dilaporkan.clear();
+        } else if (perintah == "MAJU") {
+            int batas = 0, jumlah = 0;
+            ss >> batas >> jumlah;
+            for (int i = 0; i < jumlah && terimaBaris(fd, buffer, baris); ++i) {
+                stringstream kiriman(baris);
+                string kota, dari;
+                int jarak;
+                if (!(kiriman >> kota >> jarak >> dari) || !akhirBaris(kiriman) || jarak < 0 || !shard.dist.count(kota)) continue;
+                if (jarak < shard.dist[kota]) {
+                    shard.dist[kota] = jarak;
+                    shard.prev[kota] = dari;
+                    shard.pq.push({jarak, kota});
+                }
+            }
+            cariDenganKebijakan(AksesGraph{shard.sub}, shard.menitAwal, shard.dist, shard.prev, shard.pq, BiayaWaktuTempuh(),
+                                FilterTersedia{shard.hari}, TanpaHeuristik(), HentiBatasWaktu{batas});
+            for (const auto &kota : shard.kotaLuar) {
+                int jarak = shard.dist[kota];
+                auto it = shard.dilaporkan.find(kota);
+                if (jarak == TAK_HINGGA || (it != shard.dilaporkan.end() && it->second <= jarak)) continue;
+                shard.dilaporkan[kota] = jarak;
+                balasan.push_back(kota + " " + to_string(jarak) + " " + shard.prev[kota]);
+            }
+            auto itTujuan = shard.dist.find(shard.tujuan);
+            if (region.count(shard.tujuan) && region.at(shard.tujuan) == shard.id && itTujuan != shard.dist.end() &&
+                itTujuan->second != TAK_HINGGA) {
+                balasan.push_back("TUJUAN " + to_string(itTujuan->second));
+            }
+            balasan.push_back("MIN " + to_string(jarakAntrianShard(shard)));
+        } else if (perintah == "RUTE") {
+            string kota;
+            ss >> kota;
+            vector<string> potongan = {kota};
+            string sebelum = "-";
+            for (auto it = shard.prev.find(kota); it != shard.prev.end(); it = shard.prev.find(it->second)) {
+                if (region.at(it->second) != shard.id) {
+                    sebelum = it->second; // Potongan ini dimasuki lewat edge potong dari region lain
+                    break;
+                }
+                potongan.push_back(it->second);
+            }
+            balasan.push_back(sebelum);
+            balasan.insert(balasan.end(), potongan.rbegin(), potongan.rend());
+        } else if (perintah == "MEMORI") {
+            long jumlahEdge = 0, jumlahKota = 0;
+            for (const auto &entry : shard.sub.adjList) {
+                if (region.at(entry.first) == shard.id) jumlahKota++;
+                jumlahEdge += entry.second.size();
+            }
+            // Perkiraan overhead satu node std::map beserta kuncinya
+            const size_t NODE_MAP = 48 + sizeof(string);
+            size_t byteStatus = (shard.dist.size() + shard.dilaporkan.size()) * (NODE_MAP + sizeof(int)) +
+                                shard.prev.size() * (NODE_MAP + sizeof(string));
+            balasan.push_back(to_string(jumlahKota) + " " + to_string(jumlahEdge) + " " + to_string(perkiraanMemoriGraf(shard.sub)) +
+                              " " + to_string(byteStatus));
+        } else if (perintah == "SELESAI") {
+            return;
+        }
+
+        for (const auto &b : balasan) {
+            if (!kirimBaris(fd, b)) return;
         }
+        if (!kirimBaris(fd, ".")) return;
     }
-    fileKota.close();
-    cout << endl;
 }
 
-// Fungsi untuk mengecek ketersediaan angkutan umum berdasarkan waktu
-bool isAngkutanUmumAvailable(const AngkutanUmum &au, const string &waktu) {
-    return au.jamMulaiOperasional <= waktu && waktu <= au.jamTutupOperasional;
+// Fungsi untuk mengirim satu perintah ke shard tanpa menunggu balasan, sehingga beberapa shard bisa bekerja bersamaan.
+// Balasan diambil dengan terimaBalasanShard sesuai urutan pengiriman ke shard tersebut.
+bool kirimKeShard(KoordinatorShard &koordinator, int id, const string &perintah) {
+    koordinator.pesanTerkirim++;
+    return kirimBaris(koordinator.shard[id].fd, perintah);
 }
 
-// Fungsi untuk memuat data angkutan umum dari file
-void muatDataAngkutanUmum(vector<AngkutanUmum> &angkutanUmum, const string &namaFile) {
-    ifstream file(namaFile);
-    string line;
+// Fungsi untuk menerima seluruh balasan dari satu perintah yang sudah dikirim ke shard
+bool terimaBalasanShard(KoordinatorShard &koordinator, int id, vector<string> &balasan) {
+    KoneksiShard &koneksi = koordinator.shard[id];
+    balasan.clear();
+    string baris;
+    while (terimaBaris(koneksi.fd, koneksi.buffer, baris)) {
+        if (baris == ".") return true;
+        balasan.push_back(baris);
+    }
+    return false;
+}
 
-    while (getline(file, line)) {
-        stringstream ss(line);
-        AngkutanUmum angkutan;
-        ss >> angkutan.nama >> angkutan.kotaAsal >> angkutan.kotaTujuan >> angkutan.jamMulaiOperasional >> angkutan.jamTutupOperasional >> angkutan.waktuTempuh;
-        angkutanUmum.push_back(angkutan);
+// Fungsi untuk mengirim satu perintah ke shard dan menunggu seluruh balasannya
+bool kirimPerintahShard(KoordinatorShard &koordinator, int id, const string &perintah, vector<string> &balasan) {
+    return kirimKeShard(koordinator, id, perintah) && terimaBalasanShard(koordinator, id, balasan);
+}
+
+// Fungsi untuk mempartisi graf lalu menjalankan satu proses shard per region yang terhubung ke koordinator
+// melalui socket lokal (socketpair). Setiap proses anak hanya menyimpan graf region miliknya.
+bool mulaiShard(KoordinatorShard &koordinator, const Graph &graph, int jumlahRegion) {
+    koordinator.region = partisiKota(graph, jumlahRegion);
+    if (koordinator.region.empty()) return false;
+    int jumlah = 0;
+    for (const auto &r : koordinator.region) jumlah = max(jumlah, r.second + 1);
+
+    // Menunggu tidak pernah negatif, sehingga setiap lintasan edge potong memakan paling sedikit waktu tempuh tersingkat ini
+    koordinator.bobotPotongMinimum = numeric_limits<int>::max();
+    for (const auto &entry : graph.adjList) {
+        for (const auto &neighbor : entry.second) {
+            const AngkutanUmum &au = neighbor.second;
+            if (au.dibatalkan || koordinator.region[entry.first] == koordinator.region[neighbor.first]) continue;
+            koordinator.bobotPotongMinimum = min(koordinator.bobotPotongMinimum, max(au.waktuTempuh + au.keterlambatan, 0));
+        }
     }
 
-    file.close();
+    for (int id = 0; id < jumlah; ++id) {
+        int pasangan[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, pasangan) != 0) {
+            cout << "Gagal membuat socket shard!\n";
+            return false;
+        }
+        pid_t pid = fork();
+        if (pid < 0) {
+            cout << "Gagal menjalankan proses shard!\n";
+            close(pasangan[0]);
+            close(pasangan[1]);
+            return false;
+        }
+        if (pid == 0) {
+            // Proses shard: tutup socket milik koordinator dan shard lain, lalu layani perintah sampai selesai
+            close(pasangan[0]);
+            for (const auto &lain : koordinator.shard) close(lain.fd);
+            RegionShard shard = bangunRegionShard(graph, koordinator.region, id);
+            layaniShard(pasangan[1], shard, koordinator.region);
+            close(pasangan[1]);
+            _exit(0);
+        }
+        close(pasangan[1]);
+        KoneksiShard koneksi;
+        koneksi.pid = pid;
+        koneksi.fd = pasangan[0];
+        koordinator.shard.push_back(koneksi);
+    }
+    return true;
 }
 
-// Fungsi untuk menambahkan angkutan umum ke graf
-void tambahAngkutanUmumKeGraf(Graph &graph, const AngkutanUmum &au) {
-    // Tambahkan kota tujuan ke graf jika belum ada
-    if (graph.adjList.find(au.kotaTujuan) == graph.adjList.end()) {
-        graph.adjList[au.kotaTujuan] = {};
+// Fungsi untuk menghentikan semua proses shard
+void hentikanShard(KoordinatorShard &koordinator) {
+    for (auto &koneksi : koordinator.shard) {
+        kirimBaris(koneksi.fd, "SELESAI");
+        close(koneksi.fd);
+        waitpid(koneksi.pid, nullptr, 0);
     }
-    // Tambahkan angkutan umum ke kota asal
-    graph.adjList[au.kotaAsal].push_back({au.kotaTujuan, au});
+    koordinator.shard.clear();
 }
 
-// Fungsi untuk mencari rute tercepat berdasarkan angkutan umum yang tersedia dan waktu tempuh tercepat
-vector<string> cariRuteTercepat(const Graph &graph, const string &asal, const string &tujuan, const string &waktu) {
-    if (graph.adjList.find(asal) == graph.adjList.end() || graph.adjList.find(tujuan) == graph.adjList.end()) {
+// Fungsi untuk mencari rute tercepat dengan menjalankan satu Dijkstra berbasis waktu tiba yang tersebar di semua shard
+// (setara cariRuteTercepat). Setiap putaran, kota berjarak paling kecil yang masih menunggu di semua shard menentukan
+// batas = jarak tersebut + bobot edge potong tersingkat: kiriman lewat edge potong tidak mungkin lebih kecil dari batas,
+// sehingga semua shard boleh memfinalkan kota sampai batas itu secara bersamaan.
+vector<string> cariRuteTercepatTerpartisi(KoordinatorShard &koordinator, const string &asal, const string &tujuan,
+                                          const string &waktu, int hari = 0) {
+    int menitAwal = waktuKeMenit(waktu);
+    if (!koordinator.region.count(asal) || !koordinator.region.count(tujuan) || asal == tujuan || menitAwal < 0) {
         return {}; // Kota asal atau tujuan tidak ada di dalam graf
     }
 
-    map<string, int> dist;
-    map<string, string> prev;
-    set<string> visited;
-    priority_queue<pair<int, string>, vector<pair<int, string>>, greater<pair<int, string>>> pq;
+    const int TAK_HINGGA = numeric_limits<int>::max();
+    size_t jumlahShard = koordinator.shard.size();
+    vector<string> balasan;
+    string mulai = "MULAI " + asal + " " + to_string(menitAwal) + " " + to_string(hari) + " " + tujuan;
+    vector<bool> terkirim(jumlahShard);
+    for (size_t id = 0; id < jumlahShard; ++id) {
+        terkirim[id] = kirimKeShard(koordinator, id, mulai);
+    }
+    // Semua balasan tetap dibaca agar tidak ada balasan tertinggal untuk query berikutnya
+    bool berhasil = true;
+    for (size_t id = 0; id < jumlahShard; ++id) {
+        berhasil = terkirim[id] && terimaBalasanShard(koordinator, id, balasan) && berhasil;
+    }
+    if (!berhasil) return {};
+
+    vector<int> jarakAntrian(jumlahShard, TAK_HINGGA); // Jarak terkecil yang menunggu di setiap shard
+    jarakAntrian[koordinator.region[asal]] = 0;
+    vector<map<string, pair<int, string>>> kiriman(jumlahShard); // Kota -> (jarak, dari) yang belum dikirim ke shard-nya
+    int jarakTujuan = TAK_HINGGA;
+    while (true) {
+        int terkecil = TAK_HINGGA;
+        for (size_t id = 0; id < jumlahShard; ++id) {
+            terkecil = min(terkecil, jarakAntrian[id]);
+            for (const auto &k : kiriman[id]) terkecil = min(terkecil, k.second.first);
+        }
+        if (terkecil == TAK_HINGGA || terkecil >= jarakTujuan) break; // Habis, atau jarak ke tujuan sudah final
+
+        int batas = static_cast<int>(min<long long>(TAK_HINGGA - 1, static_cast<long long>(terkecil) + koordinator.bobotPotongMinimum));
+        vector<bool> aktif(jumlahShard, false);
+        for (size_t id = 0; id < jumlahShard; ++id) {
+            if (kiriman[id].empty() && jarakAntrian[id] > batas) continue;
+            string perintah = "MAJU " + to_string(batas) + " " + to_string(kiriman[id].size());
+            for (const auto &k : kiriman[id]) {
+                perintah += "\n" + k.first + " " + to_string(k.second.first) + " " + k.second.second;
+            }
+            kiriman[id].clear();
+            aktif[id] = kirimKeShard(koordinator, id, perintah);
+            if (!aktif[id]) berhasil = false;
+        }
+        for (size_t id = 0; id < jumlahShard; ++id) {
+            if (!aktif[id]) continue;
+            if (!terimaBalasanShard(koordinator, id, balasan)) {
+                berhasil = false;
+                continue;
+            }
+            // Baris yang tidak sesuai format membatalkan query; balasan shard lain tetap dibaca sampai habis
+            bool adaMin = false;
+            for (const auto &baris : balasan) {
+                stringstream ss(baris);
+                string kota, dari;
+                int jarak;
+                if (!(ss >> kota >> jarak)) {
+                    berhasil = false;
+                } else if (kota == "MIN") {
+                    berhasil = berhasil && jarak >= -1 && akhirBaris(ss);
+                    jarakAntrian[id] = jarak < 0 ? TAK_HINGGA : jarak;
+                    adaMin = true;
+                } else if (kota == "TUJUAN") {
+                    berhasil = berhasil && jarak >= 0 && akhirBaris(ss);
+                    jarakTujuan = min(jarakTujuan, jarak);
+                } else if (ss >> dari && akhirBaris(ss) && jarak >= 0 && koordinator.region.count(kota) &&
+                           koordinator.region[kota] != static_cast<int>(id) && koordinator.region.count(dari)) {
+                    pair<int, string> &k = kiriman[koordinator.region[kota]][kota];
+                    if (k.second.empty() || jarak < k.first) k = {jarak, dari};
+                } else {
+                    berhasil = false;
+                }
+            }
+            berhasil = berhasil && adaMin;
+        }
+        if (!berhasil) {
+            cerr << "Balasan shard tidak valid atau koneksi terputus." << endl;
+            return {};
+        }
+    }
+    if (jarakTujuan == TAK_HINGGA) {
+        return {}; // Tidak ada rute yang ditemukan
+    }
 
-    // Inisialisasi jarak semua lokasi dengan nilai tak hingga
-    for (const auto &loc : graph.adjList) {
-        dist[loc.first] = numeric_limits<int>::max();
+    // Rute dirangkai mundur dari tujuan: setiap shard mengembalikan potongannya dan kota region lain sebelum potongan itu
+    vector<string> path;
+    string kota = tujuan;
+    for (size_t langkah = 0; langkah < koordinator.region.size() && kota != "-"; ++langkah) {
+        if (!kirimPerintahShard(koordinator, koordinator.region[kota], "RUTE " + kota, balasan) || balasan.size() < 2) return {};
+        path.insert(path.begin(), balasan.begin() + 1, balasan.end());
+        kota = balasan[0];
     }
+    return kota == "-" && path.front() == asal ? path : vector<string>();
+}
+#endif
 
-    // Jarak dari kota asal ke dirinya sendiri adalah 0
-    dist[asal] = 0;
-    pq.push({0, asal});
+// Fungsi untuk membaca daftar kota terdaftar sesuai urutan di file
+vector<string> bacaKotaTerdaftar(const string &namaFileKota) {
+    vector<string> daftar;
+    ifstream file(namaFileKota);
+    string namaKota;
+    while (getline(file, namaKota)) {
+        daftar.push_back(namaKota);
+    }
+    file.close();
+    return daftar;
+}
 
-    // Proses algoritma Dijkstra
-    while (!pq.empty()) {
-        string current = pq.top().second;
-        pq.pop();
+// Fungsi untuk menghitung sidik jari (FNV-1a) dari graf termasuk overlay gangguan dan daftar kota terdaftar.
+// Indeks di disk hanya dipakai jika sidik jarinya sama dengan graf yang sedang dimuat.
+unsigned long long sidikJariGraf(const Graph &graph, const vector<string> &kotaTerdaftar) {
+    unsigned long long hash = 1469598103934665603ULL;
+    auto tambah = [&](const string &teks) {
+        for (unsigned char c : teks) {
+            hash = (hash ^ c) * 1099511628211ULL;
+        }
+        hash = (hash ^ 0xff) * 1099511628211ULL; // Pemisah antar field
+    };
+    for (const auto &kota : kotaTerdaftar) {
+        tambah(kota);
+    }
+    for (const auto &entry : graph.adjList) {
+        tambah(entry.first);
+        for (const auto &neighbor : entry.second) {
+            const AngkutanUmum &au = neighbor.second;
+            tambah(au.nama + " " + au.kotaTujuan + " " + au.jamMulaiOperasional + " " + au.jamTutupOperasional + " " +
+                   to_string(au.waktuTempuh) + " " + to_string(au.frekuensi) + " " + au.hariOperasi + " " +
+                   to_string(au.keterlambatan) + " " + (au.dibatalkan ? "1" : "0"));
+        }
+    }
+    return hash;
+}
 
-        // Skip jika kota sudah dikunjungi sebelumnya
-        if (visited.find(current) != visited.end()) continue;
-        visited.insert(current);
+// Fungsi untuk mengelompokkan hari 0..7 yang memiliki himpunan layanan beroperasi yang sama,
+// sehingga indeks cukup dihitung sekali per kelompok (biasanya: abaikan hari, hari kerja, akhir pekan)
+vector<int> kelompokkanHari(const Graph &graph, int &jumlahKelompok) {
+    vector<int> kelompok(8);
+    map<vector<bool>, int> kelompokDariPola;
+    for (int hari = 0; hari <= 7; ++hari) {
+        vector<bool> beroperasi;
+        for (const auto &entry : graph.adjList) {
+            for (const auto &neighbor : entry.second) {
+                beroperasi.push_back(isAngkutanUmumBeroperasiPadaHari(neighbor.second, hari));
+            }
+        }
+        auto it = kelompokDariPola.find(beroperasi);
+        if (it == kelompokDariPola.end()) {
+            it = kelompokDariPola.insert({beroperasi, static_cast<int>(kelompokDariPola.size())}).first;
+        }
+        kelompok[hari] = it->second;
+    }
+    jumlahKelompok = static_cast<int>(kelompokDariPola.size());
+    return kelompok;
+}
 
-        // Iterasi semua tetangga dari kota saat ini
-        for (const auto &neighbor : graph.adjList.at(current)) {
-            string next = neighbor.first;
-            const AngkutanUmum &au = neighbor.second;
+// Fungsi untuk mengecek apakah ada angkutan umum tersedia yang berangkat dari kota asal tepat pada menit tertentu.
+// Tanpa keberangkatan, penumpang yang berangkat semenit kemudian naik angkutan yang sama dan tiba di setiap kota pada
+// menit yang sama; semua jarak berkurang satu menit sehingga urutan Dijkstra dan pola rutenya tidak berubah.
+bool adaKeberangkatanDari(const Graph &graph, const string &asal, int menit, int hari) {
+    for (const auto &neighbor : graph.adjList.at(asal)) {
+        const AngkutanUmum &au = neighbor.second;
+        if (!au.dibatalkan && isAngkutanUmumAvailable(au, menit, hari) && waktuTungguAngkutanUmum(au, menit) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
 
-            // Periksa ketersediaan angkutan umum berdasarkan waktu
-            if (!isAngkutanUmumAvailable(au, waktu)) continue;
+// Fungsi untuk membangun indeks pola rute antar kota terdaftar secara paralel di kumpulan thread bersama.
+// Setiap tugas mengerjakan satu pasangan (kelompok hari, kota asal): satu pohon rute per menit evaluasi memberi
+// rute tercepat ke semua tujuan, lalu rute alternatif dicari hanya untuk tujuan yang terjangkau.
+IndeksPolaRute bangunIndeksPolaRute(const Graph &graph, const vector<string> &kotaTerdaftar) {
+    const int MENIT_PER_HARI = 24 * 60;
+    IndeksPolaRute indeks;
+    indeks.sidikJari = sidikJariGraf(graph, kotaTerdaftar);
+    for (const auto &kota : kotaTerdaftar) {
+        if (indeks.idKota.count(kota)) continue;
+        indeks.idKota[kota] = static_cast<int>(indeks.namaKota.size());
+        indeks.namaKota.push_back(kota);
+    }
+    int n = indeks.jumlahTerdaftar = static_cast<int>(indeks.namaKota.size());
+    for (const auto &entry : graph.adjList) {
+        if (indeks.idKota.count(entry.first)) continue;
+        indeks.idKota[entry.first] = static_cast<int>(indeks.namaKota.size());
+        indeks.namaKota.push_back(entry.first);
+    }
 
-            int weight = au.waktuTempuh;
+    int jumlahKelompok;
+    indeks.kelompokHari = kelompokkanHari(graph, jumlahKelompok);
+    vector<int> hariWakil(jumlahKelompok);
+    for (int hari = 7; hari >= 0; --hari) {
+        hariWakil[indeks.kelompokHari[hari]] = hari;
+    }
+    indeks.interval.assign(static_cast<size_t>(jumlahKelompok) * n * n, {});
+
+    // Setiap tugas menyimpan pola di tabelnya sendiri; pola digabung setelah semua tugas selesai
+    int jumlahTugas = jumlahKelompok * n;
+    vector<vector<vector<int>>> polaTugas(jumlahTugas);
+    auto kerjakan = [&](int tugas) {
+        int kelompok = tugas / n, asal = tugas % n;
+        int hari = hariWakil[kelompok];
+        const string &namaAsal = indeks.namaKota[asal];
+        map<vector<int>, int> idPola;
+        auto simpanPola = [&](const vector<string> &rute) {
+            if (rute.empty()) return -1;
+            vector<int> urutan;
+            for (const auto &kota : rute) urutan.push_back(indeks.idKota.at(kota));
+            auto it = idPola.find(urutan);
+            if (it == idPola.end()) {
+                it = idPola.insert({urutan, static_cast<int>(polaTugas[tugas].size())}).first;
+                polaTugas[tugas].push_back(urutan);
+            }
+            return it->second;
+        };
+
+        // Pencarian hanya diulang pada menit yang hasilnya bisa berbeda dari menit evaluasi sebelumnya: hasilnya tetap sama
+        // selama pencarian hanya bergeser (menitTetap) dan selama tidak ada keberangkatan dari kota asal
+        for (int menit = 0; menit < MENIT_PER_HARI && graph.adjList.count(namaAsal);) {
+            string waktu = menitKeWaktu(menit);
+            int menitTetap = numeric_limits<int>::max();
+            map<string, int> dist;
+            map<string, string> prev;
+            AntrianDijkstra pq;
+            mulaiPencarian(graph, namaAsal, dist, prev, pq);
+            cariDenganKebijakan(AksesGraph{graph}, menit, dist, prev, pq, BiayaWaktuTempuh(),
+                                FilterCatatMenitTetap<FilterTersedia>{{hari}, hari, menitTetap}, TanpaHeuristik(),
+                                HentiBatasWaktu{numeric_limits<int>::max()});
+            for (int tujuan = 0; tujuan < n; ++tujuan) {
+                const string &namaTujuan = indeks.namaKota[tujuan];
+                vector<string> ruteTercepat = tujuan == asal ? vector<string>() : rekonstruksiRute(prev, namaTujuan);
+                int tercepat = simpanPola(ruteTercepat);
+                int alternatif =
+                    simpanPola(cariRuteAlternatifDari(graph, namaAsal, namaTujuan, waktu, hari, ruteTercepat, &menitTetap));
+
+                vector<IntervalPola> &daftar = indeks.interval[(static_cast<size_t>(kelompok) * n + asal) * n + tujuan];
+                if (daftar.empty() || daftar.back().polaTercepat != tercepat || daftar.back().polaAlternatif != alternatif) {
+                    daftar.push_back({menit, tercepat, alternatif});
+                }
+            }
 
-            // Update jarak jika menemukan jarak yang lebih pendek
-            if (dist[current] + weight < dist[next]) {
-                dist[next] = dist[current] + weight;
-                prev[next] = current;
-                pq.push({dist[next], next});
+            int berikutnya = menit + 1;
+            while (berikutnya < MENIT_PER_HARI &&
+                   (berikutnya - menit <= menitTetap || !adaKeberangkatanDari(graph, namaAsal, berikutnya - 1, hari))) {
+                ++berikutnya;
+            }
+            menit = berikutnya;
+        }
+    };
+
+    jalankanParalel(jumlahTugas, [&](size_t tugas) {
+        kerjakan(static_cast<int>(tugas));
+    });
+
+    // Gabungkan tabel pola setiap tugas menjadi satu tabel dan tulis ulang indeks pola di interval
+    map<vector<int>, int> idPolaGlobal;
+    for (int tugas = 0; tugas < jumlahTugas; ++tugas) {
+        vector<int> petaPola;
+        for (const auto &urutan : polaTugas[tugas]) {
+            auto it = idPolaGlobal.find(urutan);
+            if (it == idPolaGlobal.end()) {
+                it = idPolaGlobal.insert({urutan, static_cast<int>(indeks.pola.size())}).first;
+                indeks.pola.push_back(urutan);
+            }
+            petaPola.push_back(it->second);
+        }
+        int kelompok = tugas / n, asal = tugas % n;
+        for (int tujuan = 0; tujuan < n; ++tujuan) {
+            for (auto &iv : indeks.interval[(static_cast<size_t>(kelompok) * n + asal) * n + tujuan]) {
+                if (iv.polaTercepat >= 0) iv.polaTercepat = petaPola[iv.polaTercepat];
+                if (iv.polaAlternatif >= 0) iv.polaAlternatif = petaPola[iv.polaAlternatif];
             }
         }
     }
+    indeks.kedaluwarsa = false;
+    return indeks;
+}
 
-    // Rekonstruksi rute tercepat dari kota asal ke kota tujuan
-    vector<string> path;
-    for (string at = tujuan; !at.empty(); at = prev[at]) {
-        path.push_back(at);
+// Fungsi untuk menjawab rute tercepat dan alternatif dari indeks (pencarian biner pada rentang menit).
+// Mengembalikan false jika indeks kedaluwarsa atau pertanyaan di luar cakupan indeks; pemanggil lalu mencari langsung.
+bool cariRuteTerindeks(const IndeksPolaRute &indeks, const string &asal, const string &tujuan, const string &waktu, int hari,
+                       vector<string> &ruteTercepat, vector<string> &ruteAlternatif) {
+    if (indeks.kedaluwarsa || hari < 0 || hari > 7) return false;
+    auto itAsal = indeks.idKota.find(asal);
+    auto itTujuan = indeks.idKota.find(tujuan);
+    if (itAsal == indeks.idKota.end() || itTujuan == indeks.idKota.end() || itAsal->second >= indeks.jumlahTerdaftar ||
+        itTujuan->second >= indeks.jumlahTerdaftar) {
+        return false; // Hanya kota terdaftar yang diindeks
     }
-    reverse(path.begin(), path.end());
+    int menit = waktuKeMenit(waktu);
+    if (menit < 0 || menit >= 24 * 60) return false;
+
+    int n = indeks.jumlahTerdaftar;
+    const vector<IntervalPola> &daftar =
+        indeks.interval[(static_cast<size_t>(indeks.kelompokHari[hari]) * n + itAsal->second) * n + itTujuan->second];
+    auto it = upper_bound(daftar.begin(), daftar.end(), menit, [](int m, const IntervalPola &iv) { return m < iv.menitMulai; });
+    if (it == daftar.begin()) return false;
+    --it;
+
+    auto keNama = [&](int idPola, vector<string> &rute) {
+        rute.clear();
+        if (idPola < 0) return;
+        for (int kota : indeks.pola[idPola]) rute.push_back(indeks.namaKota[kota]);
+    };
+    keNama(it->polaTercepat, ruteTercepat);
+    keNama(it->polaAlternatif, ruteAlternatif);
+    return true;
+}
 
-    if (path.size() == 1 && path[0] == asal) {
-        return {}; // Tidak ada rute yang ditemukan
+// Fungsi untuk menyimpan indeks pola rute ke file biner.
+// Format: "POLARUT1", sidik jari, nama kota, kelompok hari, pola (panjang + ID kota), lalu rentang menit setiap pasangan.
+bool simpanIndeksPolaRute(const IndeksPolaRute &indeks, const string &namaFile) {
+    ofstream file(namaFile, ios::binary);
+    if (!file.is_open()) {
+        cout << "Gagal menulis file indeks " << namaFile << "!\n";
+        return false;
     }
-
-    return path;
+    file.write("POLARUT1", 8);
+    tulisInt(file, static_cast<int>(indeks.sidikJari >> 32));
+    tulisInt(file, static_cast<int>(indeks.sidikJari & 0xffffffffULL));
+    tulisInt(file, static_cast<int>(indeks.namaKota.size()));
+    for (const auto &kota : indeks.namaKota) {
+        tulisString(file, kota);
+    }
+    tulisInt(file, indeks.jumlahTerdaftar);
+    for (int kelompok : indeks.kelompokHari) {
+        tulisInt(file, kelompok);
+    }
+    tulisInt(file, static_cast<int>(indeks.pola.size()));
+    for (const auto &urutan : indeks.pola) {
+        tulisInt(file, static_cast<int>(urutan.size()));
+        for (int kota : urutan) tulisInt(file, kota);
+    }
+    tulisInt(file, static_cast<int>(indeks.interval.size()));
+    for (const auto &daftar : indeks.interval) {
+        tulisInt(file, static_cast<int>(daftar.size()));
+        for (const auto &iv : daftar) {
+            tulisInt(file, iv.menitMulai);
+            tulisInt(file, iv.polaTercepat);
+            tulisInt(file, iv.polaAlternatif);
+        }
+    }
+    return static_cast<bool>(file);
 }
 
+// Fungsi untuk memuat indeks pola rute dari file. Indeks hanya aktif jika sidik jarinya sama dengan sidik jari graf saat ini.
+bool muatIndeksPolaRute(IndeksPolaRute &indeks, const string &namaFile, unsigned long long sidikJariSaatIni) {
+    indeks = IndeksPolaRute();
+    ifstream file(namaFile, ios::binary);
+    char magic[8];
+    if (!file.is_open() || !file.read(magic, 8) || string(magic, 8) != "POLARUT1") {
+        return false;
+    }
+    unsigned long long atas = static_cast<unsigned int>(bacaInt(file));
+    unsigned long long bawah = static_cast<unsigned int>(bacaInt(file));
+    indeks.sidikJari = (atas << 32) | bawah;
+    if (indeks.sidikJari != sidikJariSaatIni) {
+        return false; // Graf sudah berubah sejak indeks dibangun
+    }
 
-// Fungsi untuk mencari rute alternatif (rute tercepat kedua)
-vector<string> cariRuteAlternatif(const Graph &graph, const string &asal, const string &tujuan, const string &waktu) {
-    // Mencari rute tercepat pertama
-    vector<string> ruteTercepat = cariRuteTercepat(graph, asal, tujuan, waktu);
-
-    // Menghapus rute tercepat pertama dari graf
-    Graph graphWithoutFastestRoute = graph;
-    string prevNode = asal;
-    for (const auto &node : ruteTercepat) {
-        if (node != asal) {
-            auto &neighbors = graphWithoutFastestRoute.adjList[prevNode];
-            neighbors.erase(remove_if(neighbors.begin(), neighbors.end(), [&](const pair<string, AngkutanUmum> &neighbor) {
-                return neighbor.first == node;
-            }), neighbors.end());
+    int jumlahKota = bacaInt(file);
+    for (int i = 0; i < jumlahKota && file; ++i) {
+        indeks.namaKota.push_back(bacaString(file));
+        indeks.idKota[indeks.namaKota.back()] = i;
+    }
+    indeks.jumlahTerdaftar = bacaInt(file);
+    indeks.kelompokHari.resize(8);
+    for (int &kelompok : indeks.kelompokHari) {
+        kelompok = bacaInt(file);
+    }
+    int jumlahPola = bacaInt(file);
+    for (int i = 0; i < jumlahPola && file; ++i) {
+        vector<int> urutan(max(bacaInt(file), 0));
+        for (int &kota : urutan) kota = bacaInt(file);
+        indeks.pola.push_back(urutan);
+    }
+    int jumlahDaftar = bacaInt(file);
+    for (int i = 0; i < jumlahDaftar && file; ++i) {
+        vector<IntervalPola> daftar(max(bacaInt(file), 0));
+        for (auto &iv : daftar) {
+            iv.menitMulai = bacaInt(file);
+            iv.polaTercepat = bacaInt(file);
+            iv.polaAlternatif = bacaInt(file);
         }
-        prevNode = node;
+        indeks.interval.push_back(daftar);
     }
-
-    // Mencari rute tercepat kedua
-    return cariRuteTercepat(graphWithoutFastestRoute, asal, tujuan, waktu);
+    if (!file) {
+        indeks = IndeksPolaRute();
+        return false; // File terpotong atau rusak
+    }
+    indeks.kedaluwarsa = false;
+    return true;
 }
 
 // Fungsi untuk melihat jadwal angkutan umum dengan nomor
@@ -184,8 +2618,14 @@ void lihatJadwalAngkutanUmum(const vector<AngkutanUmum> &angkutanUmum) {
     int index = 1;
     for (const auto &au : angkutanUmum) {
         cout << index++ << ". " << au.nama << " dari " << au.kotaAsal << " ke " << au.kotaTujuan
-             << "\n --> Jam Operasi: " << au.jamMulaiOperasional << " - " << au.jamTutupOperasional
-             << ".\n --> Waktu tempuh: " << au.waktuTempuh << " menit.\n";
+             << "\n --> Jam Operasi: " << au.jamMulaiOperasional << " - " << au.jamTutupOperasional << ".\n";
+        if (au.frekuensi > 0) {
+            cout << " --> Berangkat setiap " << au.frekuensi << " menit.\n";
+        }
+        if (!au.hariOperasi.empty()) {
+            cout << " --> Hari operasi: " << namaHariOperasi(au.hariOperasi) << ".\n";
+        }
+        cout << " --> Waktu tempuh: " << au.waktuTempuh << " menit.\n";
         cout << "---------------------------------------------\n";
     }
 }
@@ -209,10 +2649,7 @@ vector<AngkutanUmum> bacaDataAngkutanUmum(const string& namaFile) {
     ifstream file(namaFile);
     string line;
     while (getline(file, line)) {
-        stringstream ss(line);
-        AngkutanUmum angkutan;
-        ss >> angkutan.nama >> angkutan.kotaAsal >> angkutan.kotaTujuan >> angkutan.jamMulaiOperasional >> angkutan.jamTutupOperasional >> angkutan.waktuTempuh;
-        angkutanUmum.push_back(angkutan);
+        angkutanUmum.push_back(bacaBarisAngkutanUmum(line));
     }
     return angkutanUmum;
 }
@@ -226,7 +2663,15 @@ void tulisDataAngkutanUmum(const vector<AngkutanUmum> &data, const string &namaF
     }
 
     for (const auto &au : data) {
-        file << au.nama << " " << au.kotaAsal << " " << au.kotaTujuan << " " << au.jamMulaiOperasional << " " << au.jamTutupOperasional << " " << au.waktuTempuh << endl;
+        file << au.nama << " " << au.kotaAsal << " " << au.kotaTujuan << " " << au.jamMulaiOperasional << " " << au.jamTutupOperasional << " " << au.waktuTempuh;
+        // Kolom opsional hanya ditulis untuk layanan berkala atau yang memiliki pola hari
+        if (au.frekuensi > 0 || !au.hariOperasi.empty()) {
+            file << " " << au.frekuensi;
+            if (!au.hariOperasi.empty()) {
+                file << " " << au.hariOperasi;
+            }
+        }
+        file << endl;
     }
 
     file.close();
@@ -320,6 +2765,13 @@ void tambahJadwalAngkutanUmum(vector<AngkutanUmum> &angkutanUmum, Graph &graph,
     cin >> au.jamTutupOperasional;
     cout << "Masukkan waktu tempuh (dalam menit): ";
     cin >> au.waktuTempuh;
+    cout << "Masukkan interval keberangkatan (dalam menit, 0 jika tidak berkala): ";
+    cin >> au.frekuensi;
+    cout << "Masukkan pola hari operasi Senin-Minggu (mis. 1111100, - untuk setiap hari): ";
+    cin >> au.hariOperasi;
+    if (au.hariOperasi == "-") {
+        au.hariOperasi = "";
+    }
 
     // Tambahkan kota asal dan kota tujuan ke dalam file kota terdaftar jika belum terdaftar
     tambahKota(graph, au.kotaAsal, angkutanUmum, namaFileKota);
@@ -364,7 +2816,8 @@ void hapusJadwalAngkutanUmum(vector<AngkutanUmum> &angkutanUmum, Graph &graph, c
         [&au](const pair<string, AngkutanUmum> &p) {
             return p.second.nama == au.nama && p.second.kotaAsal == au.kotaAsal && p.second.kotaTujuan == au.kotaTujuan
                    && p.second.jamMulaiOperasional == au.jamMulaiOperasional && p.second.jamTutupOperasional == au.jamTutupOperasional
-                   && p.second.waktuTempuh == au.waktuTempuh;
+                   && p.second.waktuTempuh == au.waktuTempuh && p.second.frekuensi == au.frekuensi
+                   && p.second.hariOperasi == au.hariOperasi;
         }), graph.adjList[au.kotaAsal].end());
 
     cout << "Jadwal angkutan umum berhasil dihapus.\n";
@@ -374,7 +2827,7 @@ void hapusJadwalAngkutanUmum(vector<AngkutanUmum> &angkutanUmum, Graph &graph, c
 }
 
 // Fungsi untuk menampilkan rute dan rekomendasi angkutan umum yang tersedia
-void tampilkanRuteDanRekomendasi(const vector<string> &rute, const vector<AngkutanUmum> &angkutanUmum, const string &waktu) {
+void tampilkanRuteDanRekomendasi(const vector<string> &rute, const Graph &graph, const string &waktu, int hari = 0) {
     if (rute.size() < 2) {
         cout << "Tidak ada rute yang tersedia.\n";
         cout << endl;
@@ -383,21 +2836,46 @@ void tampilkanRuteDanRekomendasi(const vector<string> &rute, const vector<Angkut
 
     int total_waktu = 0;
     bool adaAngkutan = false; // Flag untuk mengecek ada tidaknya angkutan umum
+    int menit = waktuKeMenit(waktu); // Waktu tiba di kota rute[i], maju setiap kali satu potongan rute ditempuh
 
     for (size_t i = 0; i < rute.size() - 1; ++i) {
-        bool found = false;
-        for (const auto &au : angkutanUmum) {
-            if (au.kotaAsal == rute[i] && au.kotaTujuan == rute[i + 1] && isAngkutanUmumAvailable(au, waktu)) {
-                cout << "Gunakan [" << au.nama << "] dari [" << rute[i] << "] ke [" << rute[i + 1] << "] (" << au.jamMulaiOperasional << " - " << au.jamTutupOperasional << ")\n--> waktu tempuh: " << au.waktuTempuh <<" menit \n";
-                found = true;
-                adaAngkutan = true; // Menandakan ada angkutan umum yang ditemukan
-                total_waktu += au.waktuTempuh;
-                break;
+        // Pilih angkutan umum dengan bobot paling kecil saat tiba di kota ini (sama dengan bobot pada Dijkstra, termasuk feed gangguan)
+        const AngkutanUmum *terbaik = nullptr;
+        int bobotTerbaik = -1;
+        auto itKota = graph.adjList.find(rute[i]);
+        if (itKota != graph.adjList.end()) {
+            for (const auto &neighbor : itKota->second) {
+                int weight = bobotAngkutanUmum(neighbor.second, menit, hari);
+                if (neighbor.first == rute[i + 1] && weight >= 0 && (terbaik == nullptr || weight < bobotTerbaik)) {
+                    terbaik = &neighbor.second;
+                    bobotTerbaik = weight;
+                }
+            }
+        }
+
+        bool found = terbaik != nullptr;
+        if (found) {
+            const AngkutanUmum &au = *terbaik;
+            cout << "Gunakan [" << au.nama << "] dari [" << rute[i] << "] ke [" << rute[i + 1] << "] (" << au.jamMulaiOperasional << " - " << au.jamTutupOperasional << ")\n";
+            int tunggu = waktuTungguAngkutanUmum(au, menit);
+            if (au.frekuensi > 0) {
+                cout << "--> berangkat setiap " << au.frekuensi << " menit, berikutnya pukul "
+                     << menitKeWaktu(menit + tunggu) << " (tunggu " << tunggu << " menit)\n";
+            } else if (tunggu > 0) {
+                cout << "--> mulai beroperasi pukul " << au.jamMulaiOperasional << " (tunggu " << tunggu << " menit)\n";
             }
+            cout << "--> waktu tempuh: " << au.waktuTempuh <<" menit \n";
+            if (au.keterlambatan > 0) {
+                cout << "--> terlambat " << au.keterlambatan << " menit\n";
+            }
+            adaAngkutan = true; // Menandakan ada angkutan umum yang ditemukan
+            total_waktu += bobotTerbaik;
+            menit += bobotTerbaik;
         }
 
         if (!found) {
-            cout << "Tidak ada angkutan umum tersedia dari " << rute[i] << " ke " << rute[i + 1] << " pada pukul " << waktu << ".\n";
+            cout << "Tidak ada angkutan umum tersedia dari " << rute[i] << " ke " << rute[i + 1] << " pada pukul "
+                 << (menit < 0 ? waktu : menitKeWaktu(menit)) << ".\n";
         }
     }
 
@@ -449,8 +2927,14 @@ void cariJadwalAngkutanUmum(const Graph &graph) {
                 cout << "Kota Asal: " << pair.second.kotaAsal
                      << "\nKota Tujuan: " << pair.second.kotaTujuan
                      << "\nJam Mulai: " << pair.second.jamMulaiOperasional
-                     << "\nJam Tutup: " << pair.second.jamTutupOperasional
-                     << "\nWaktu Tempuh: " << pair.second.waktuTempuh << " menit";
+                     << "\nJam Tutup: " << pair.second.jamTutupOperasional;
+                if (pair.second.frekuensi > 0) {
+                    cout << "\nFrekuensi: setiap " << pair.second.frekuensi << " menit";
+                }
+                if (!pair.second.hariOperasi.empty()) {
+                    cout << "\nHari Operasi: " << namaHariOperasi(pair.second.hariOperasi);
+                }
+                cout << "\nWaktu Tempuh: " << pair.second.waktuTempuh << " menit";
                 cout << "\n---------------------------------------------\n";
             }
         }
@@ -491,6 +2975,288 @@ string namaKotaDariNomor(Graph &graph, int nomor, const string &namaFileKota) {
     return ""; // Return empty string if the number is not valid
 }
 
+// Fungsi untuk menampilkan daftar kota lalu menanyakan kota asal, kota tujuan, pukul, dan hari perjalanan.
+// Dipakai bersama oleh semua menu pencarian rute; pertanyaan tambahan menu dan baris kosong ditulis oleh pemanggil.
+void mintaInputRute(Graph &graph, const string &namaFileKota, string &asal, string &tujuan, string &waktu, int &hari) {
+    cout << "\n-------Mau pergi ke mana?-------\n";
+    lihatDaftarKota(graph, namaFileKota);
+
+    int nomorAsal, nomorTujuan;
+    cout << "Pilih nomor kota asal: ";
+    cin >> nomorAsal;
+    asal = namaKotaDariNomor(graph, nomorAsal, namaFileKota);
+
+    cout << "Pilih nomor kota tujuan: ";
+    cin >> nomorTujuan;
+    tujuan = namaKotaDariNomor(graph, nomorTujuan, namaFileKota);
+
+    cout << "Pukul (HH:MM): ";
+    cin >> waktu;
+    cout << "Hari (1=Senin ... 7=Minggu, 0=abaikan): ";
+    cin >> hari;
+}
+
+// Fungsi untuk menanyakan kota asal, tujuan, dan waktu lalu menampilkan rute tercepat dan rute alternatif.
+// Jawaban diambil dari indeks pola rute jika masih berlaku, selain itu dicari langsung di graf.
+// awalanPesan ditambahkan di depan pesan jika rute tidak ditemukan (mis. "[!INVALID!]: " pada menu admin).
+void tampilkanPencarianRute(Graph &graph, CacheRute &cacheRute, const IndeksPolaRute &indeksPola, const string &namaFileKota,
+                            const string &awalanPesan) {
+    string asal, tujuan, waktu;
+    int hari;
+    mintaInputRute(graph, namaFileKota, asal, tujuan, waktu, hari);
+    cout << endl;
+
+    vector<string> ruteTercepat, ruteAlternatif;
+    if (!cariRuteTerindeks(indeksPola, asal, tujuan, waktu, hari, ruteTercepat, ruteAlternatif)) {
+        ruteTercepat = cariRuteTercepatTersimpan(cacheRute, graph, asal, tujuan, waktu, hari);
+        ruteAlternatif = cariRuteAlternatifDari(graph, asal, tujuan, waktu, hari, ruteTercepat);
+    }
+    if (ruteTercepat.empty()) {
+        cout << awalanPesan << "Tidak ada angkutan umum yang beroperasi atau rute tidak ditemukan!\n";
+    } else {
+
+        cout << "Rute tercepat:\n";
+        tampilkanRuteDanRekomendasi(ruteTercepat, graph, waktu, hari);
+
+        cout << "\nRute Alternatif:\n";
+        tampilkanRuteDanRekomendasi(ruteAlternatif, graph, waktu, hari);
+    }
+}
+
+// Fungsi untuk menampilkan kota-kota yang dapat dicapai dalam batas waktu tertentu
+// Pencarian berjalan di graf kompak, yang dibangun ulang lebih dulu jika graf berubah sejak terakhir dipakai.
+void tampilkanKotaTerjangkau(Graph &graph, GraphKompak &graphKompak, const string &namaFileKota) {
+    cout << "\n-------Kota terjangkau dalam batas waktu-------\n";
+    lihatDaftarKota(graph, namaFileKota);
+
+    int nomorAsal, batasMenit, hari;
+    string waktu;
+    cout << "Pilih nomor kota asal (0 = semua kota terdaftar): ";
+    cin >> nomorAsal;
+    cout << "Pukul (HH:MM): ";
+    cin >> waktu;
+    cout << "Batas waktu perjalanan (menit): ";
+    cin >> batasMenit;
+    cout << "Hari (1=Senin ... 7=Minggu, 0=abaikan): ";
+    cin >> hari;
+    cout << endl;
+
+    if (waktuKeMenit(waktu) < 0) {
+        cout << "[!INVALID!]: Format waktu tidak valid!\n";
+        return;
+    }
+    siapkanGraphKompak(graphKompak, graph);
+
+    if (nomorAsal == 0) {
+        // Mode banyak kota asal: ringkasan cakupan untuk setiap kota terdaftar
+        vector<string> daftarAsal = bacaKotaTerdaftar(namaFileKota);
+
+        vector<vector<pair<string, int>>> hasil = cariKotaTerjangkauBanyak(graphKompak, daftarAsal, waktu, batasMenit, hari);
+        cout << "Jumlah kota terjangkau dalam " << batasMenit << " menit dari pukul " << waktu << ":\n";
+        cout << "---------------------------------------------\n";
+        for (size_t i = 0; i < daftarAsal.size(); ++i) {
+            // Kota asal sendiri tidak dihitung
+            size_t jumlah = hasil[i].empty() ? 0 : hasil[i].size() - 1;
+            cout << i + 1 << ". " << daftarAsal[i] << ": " << jumlah << " kota\n";
+        }
+        cout << "---------------------------------------------\n";
+        return;
+    }
+
+    string asal = namaKotaDariNomor(graph, nomorAsal, namaFileKota);
+    vector<pair<string, int>> terjangkau = cariKotaTerjangkauKompak(graphKompak, asal, waktu, batasMenit, hari);
+    if (terjangkau.size() <= 1) {
+        cout << "Tidak ada kota yang dapat dicapai dari " << asal << " dalam " << batasMenit << " menit.\n";
+        return;
+    }
+
+    cout << "Kota yang dapat dicapai dari " << asal << " dalam " << batasMenit << " menit:\n";
+    cout << "---------------------------------------------\n";
+    int nomor = 1;
+    for (const auto &kota : terjangkau) {
+        if (kota.first == asal) continue;
+        cout << nomor++ << ". " << kota.first << " --> tiba pukul " << menitKeWaktu(waktuKeMenit(waktu) + kota.second)
+             << " (" << kota.second << " menit)\n";
+    }
+    cout << "---------------------------------------------\n";
+}
+
+// Fungsi untuk mencari rute tercepat melalui penyimpanan graf berhalaman dan menampilkan statistik halamannya
+// Store tetap terbuka di antara query sehingga halaman di buffer pool dipakai ulang oleh query berikutnya.
+void tampilkanRuteBerhalaman(Graph &graph, PenyimpananGrafBerhalaman &store, const string &namaFileKota, const string &namaFileGraf) {
+    string asal, tujuan, waktu;
+    int hari, jumlahFrame;
+    mintaInputRute(graph, namaFileKota, asal, tujuan, waktu, hari);
+    cout << "Jumlah frame buffer pool (halaman " << UKURAN_HALAMAN << " byte): ";
+    cin >> jumlahFrame;
+    cout << endl;
+
+    // File halaman hanya dibangun ulang jika graf berubah sejak file terakhir ditulis
+    if (!siapkanPenyimpananGraf(store, graph, namaFileGraf, jumlahFrame)) {
+        return;
+    }
+
+    vector<string> rute = cariRuteTercepatBerhalaman(store, asal, tujuan, waktu, hari);
+    if (rute.empty()) {
+        cout << "[!INVALID!]: Tidak ada angkutan umum yang beroperasi atau rute tidak ditemukan!\n";
+    } else {
+        cout << "Rute tercepat:\n";
+        tampilkanRuteDanRekomendasi(rute, graph, waktu, hari);
+    }
+    tampilkanStatistikHalaman(store.statistik);
+}
+
+// Fungsi untuk mencari rute tercepat melalui shard region (proses terpisah) dan membandingkannya dengan graf utuh
+void tampilkanRuteTerpartisi(Graph &graph, const string &namaFileKota) {
+#ifdef PROJEKAN_SHARD
+    string asal, tujuan, waktu;
+    int hari, jumlahRegion;
+    mintaInputRute(graph, namaFileKota, asal, tujuan, waktu, hari);
+    cout << "Jumlah region (shard): ";
+    cin >> jumlahRegion;
+    cout << endl;
+
+    if (jumlahRegion < 1) {
+        cout << "[!INVALID!]: Jumlah region minimal 1!\n";
+        return;
+    }
+
+    KoordinatorShard koordinator;
+    if (!mulaiShard(koordinator, graph, jumlahRegion)) {
+        hentikanShard(koordinator);
+        return;
+    }
+
+    auto mulai = chrono::steady_clock::now();
+    vector<string> rute = cariRuteTercepatTerpartisi(koordinator, asal, tujuan, waktu, hari);
+    double latensiShard = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count();
+    mulai = chrono::steady_clock::now();
+    cariRuteTercepat(graph, asal, tujuan, waktu, hari);
+    double latensiUtuh = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count();
+
+    if (rute.empty()) {
+        cout << "[!INVALID!]: Tidak ada angkutan umum yang beroperasi atau rute tidak ditemukan!\n";
+    } else {
+        cout << "Rute tercepat:\n";
+        tampilkanRuteDanRekomendasi(rute, graph, waktu, hari);
+    }
+
+    cout << "\nPartisi: " << koordinator.shard.size() << " region, " << hitungEdgePotong(graph, koordinator.region) << " edge potong\n";
+    vector<string> balasan;
+    for (size_t id = 0; id < koordinator.shard.size(); ++id) {
+        if (!kirimPerintahShard(koordinator, id, "MEMORI", balasan) || balasan.empty()) continue;
+        long jumlahKota, jumlahEdge, byteGraf, byteStatus;
+        stringstream(balasan[0]) >> jumlahKota >> jumlahEdge >> byteGraf >> byteStatus;
+        cout << "Shard " << id << ": " << jumlahKota << " kota, " << jumlahEdge << " edge, +/- " << byteGraf << " byte graf, "
+             << byteStatus << " byte status pencarian\n";
+    }
+    cout << "Graf utuh: +/- " << perkiraanMemoriGraf(graph) << " byte\n";
+    cout << "Latensi terpartisi: " << latensiShard << " us (" << koordinator.pesanTerkirim << " round trip), graf utuh: " << latensiUtuh
+         << " us\n";
+    hentikanShard(koordinator);
+#else
+    cout << "\nRute terpartisi membutuhkan fork dan socket POSIX, tidak tersedia di sistem ini.\n";
+#endif
+}
+
+// Fungsi untuk membaca feed gangguan dari file atau pipe lalu menampilkan latensi penerapannya
+void tampilkanFeedGangguan(Graph &graph, CacheRute &cache) {
+    string namaFileFeed;
+    cout << "Masukkan nama file/pipe feed gangguan: ";
+    cin >> namaFileFeed;
+
+    ifstream feed(namaFileFeed);
+    if (!feed.is_open()) {
+        cout << "\nGagal membuka feed " << namaFileFeed << "!\n";
+        return;
+    }
+
+    StatistikFeed statistik = prosesFeedGangguan(graph, cache, feed);
+    feed.close();
+
+    // Perubahan yang tersisa diterapkan sekaligus ke semua pohon di cache (satu perbaikan per pohon untuk seluruh feed)
+    perbaruiSemuaPohonRute(graph, cache, statistik);
+
+    cout << "\nFeed gangguan selesai diproses:\n";
+    cout << "---------------------------------------------\n";
+    cout << "Event diterima      : " << statistik.jumlahEvent << "\n";
+    cout << "Event diterapkan    : " << statistik.diterapkan << "\n";
+    cout << "Event tidak dikenal : " << statistik.tidakDikenal << "\n";
+    cout << "Pohon rute diperbaiki: " << statistik.pohonDiperbaiki << " (dari " << cache.pohon.size() << " di cache)\n";
+    if (statistik.diterapkan > 0) {
+        cout << "Rata-rata latensi per event (tanpa perbaikan pohon): " << statistik.totalMikrodetik / statistik.diterapkan << " us\n";
+        cout << "Rata-rata latensi per event (termasuk perbaikan pohon): "
+             << (statistik.totalMikrodetik + statistik.perbaikanMikrodetik) / statistik.diterapkan << " us\n";
+    }
+
+    // Pembanding: biaya menghitung ulang seluruh pohon dari awal
+    if (!cache.pohon.empty()) {
+        auto mulai = chrono::steady_clock::now();
+        for (const auto &entry : cache.pohon) {
+            bangunPohonRute(graph, entry.second.asal, entry.second.waktu, entry.second.hari);
+        }
+        double hitungUlang = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count();
+        if (statistik.pohonDiperbaiki > 0) {
+            cout << "Rata-rata perbaikan per pohon: " << statistik.perbaikanMikrodetik / statistik.pohonDiperbaiki << " us\n";
+        }
+        cout << "Hitung ulang penuh per pohon : " << hitungUlang / cache.pohon.size() << " us\n";
+    }
+    int jumlahTerlambat, jumlahBatal;
+    hitungOverlayGangguan(graph, jumlahTerlambat, jumlahBatal);
+    cout << "Layanan terlambat: " << jumlahTerlambat << ", dibatalkan: " << jumlahBatal << "\n";
+    cout << "---------------------------------------------\n";
+}
+
+// Fungsi untuk membangun indeks pola rute, menyimpannya ke disk, dan membandingkan latensi query dengan pencarian langsung
+void tampilkanIndeksPolaRute(Graph &graph, IndeksPolaRute &indeksPola, const string &namaFileKota, const string &namaFileIndeks) {
+    vector<string> kotaTerdaftar = bacaKotaTerdaftar(namaFileKota);
+    cout << "\nMembangun indeks pola rute untuk " << kotaTerdaftar.size() << " kota terdaftar ("
+         << jumlahThreadParalel() << " thread)...\n";
+    auto mulai = chrono::steady_clock::now();
+    indeksPola = bangunIndeksPolaRute(graph, kotaTerdaftar);
+    double lamaBangun = chrono::duration<double, milli>(chrono::steady_clock::now() - mulai).count();
+    if (!simpanIndeksPolaRute(indeksPola, namaFileIndeks)) {
+        return;
+    }
+
+    size_t jumlahInterval = 0;
+    for (const auto &daftar : indeksPola.interval) {
+        jumlahInterval += daftar.size();
+    }
+    ifstream file(namaFileIndeks, ios::binary | ios::ate);
+    long ukuranFile = static_cast<long>(file.tellg());
+    file.close();
+
+    // Bandingkan latensi semua pasangan kota terdaftar pada pukul 08:00 (indeks vs pencarian langsung)
+    vector<string> ruteTercepat, ruteAlternatif;
+    long jumlahQuery = 0;
+    mulai = chrono::steady_clock::now();
+    for (const auto &asal : kotaTerdaftar) {
+        for (const auto &tujuan : kotaTerdaftar) {
+            cariRuteTerindeks(indeksPola, asal, tujuan, "08:00", 0, ruteTercepat, ruteAlternatif);
+            jumlahQuery++;
+        }
+    }
+    double latensiIndeks = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / max(1L, jumlahQuery);
+    mulai = chrono::steady_clock::now();
+    for (const auto &asal : kotaTerdaftar) {
+        for (const auto &tujuan : kotaTerdaftar) {
+            ruteTercepat = cariRuteTercepat(graph, asal, tujuan, "08:00", 0);
+            cariRuteAlternatifDari(graph, asal, tujuan, "08:00", 0, ruteTercepat);
+        }
+    }
+    double latensiLangsung = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / max(1L, jumlahQuery);
+
+    cout << "Indeks pola rute selesai dibangun:\n";
+    cout << "---------------------------------------------\n";
+    cout << "Waktu bangun       : " << lamaBangun << " ms\n";
+    cout << "Pola rute unik     : " << indeksPola.pola.size() << "\n";
+    cout << "Rentang menit      : " << jumlahInterval << "\n";
+    cout << "Ukuran file        : " << ukuranFile << " byte (" << namaFileIndeks << ")\n";
+    cout << "Latensi per query  : indeks " << latensiIndeks << " us, pencarian langsung " << latensiLangsung << " us\n";
+    cout << "---------------------------------------------\n";
+}
+
 // Fungsi untuk menampilkan menu login dan register
 void tampilkanMenuLoginRegister() {
     cout << "-----SISTEM REKOMENDASI ANGKUTAN UMUM-----\n";
@@ -511,6 +3277,11 @@ void tampilkanMenuUtamaAdmin() {
     cout << "7.  Tampilkan graf antar kota\n";
     cout << "8.  Cari jadwal angkutan umum berdasarkan nama\n";
     cout << "9.  Lihat daftar kota\n";
+    cout << "10. Cari kota terjangkau dalam batas waktu\n";
+    cout << "11. Cari rute tercepat dari graf berhalaman (disk)\n";
+    cout << "12. Proses feed gangguan layanan (file/pipe)\n";
+    cout << "13. Cari rute tercepat dengan graf terpartisi (shard)\n";
+    cout << "14. Bangun indeks pola rute antar kota terdaftar\n";
     cout << "99. Logout\n";
     cout << "0.  Keluar\n";
     cout << "Pilih menu: ";
@@ -524,6 +3295,7 @@ void tampilkanMenuUtamaUser() {
     cout << "3.  Cari jadwal angkutan umum berdasarkan nama\n";
     cout << "4.  Tampilkan graf antar kota\n";
     cout << "5.  Lihat daftar kota\n";
+    cout << "6.  Cari kota terjangkau dalam batas waktu\n";
     cout << "99. Logout\n";
     cout << "0.  Keluar\n";
     cout << "Pilih menu: ";
@@ -619,6 +3391,8 @@ void logout(string &role) {
 }
 
 // Main function
+// PROJEKAN_TANPA_MAIN dipakai oleh benchmark_rute.cpp untuk memakai fungsi-fungsi di file ini tanpa menu
+#ifndef PROJEKAN_TANPA_MAIN
 int main() {
     vector<User> users = bacaDataUser();
     string role;
@@ -640,10 +3414,16 @@ int main() {
 
                     Graph graph;
                     vector<AngkutanUmum> angkutanUmum;
+                    CacheRute cacheRute; // Pohon rute yang diperbaiki oleh feed gangguan
+                    IndeksPolaRute indeksPola; // Rute antar kota terdaftar yang sudah dihitung sebelumnya
+                    PenyimpananGrafBerhalaman storeGraf; // Dibuka pada query berhalaman pertama dan tetap terbuka
+                    GraphKompak graphKompak; // Dibangun pada pencarian kota terjangkau pertama
 
                     // Baca data dari file eksternal saat memulai program
                     const string namaFile = "data_angkutan_umum.txt";
                     const string namaFileKota = "data_kota_terdaftar.txt";
+                    const string namaFileGraf = "graf_berhalaman.bin";
+                    const string namaFileIndeks = "indeks_pola_rute.bin";
                     angkutanUmum = bacaDataAngkutanUmum(namaFile);
 
                     // Masukkan daftar kota ke dalam graf
@@ -654,6 +3434,9 @@ int main() {
                         tambahAngkutanUmumKeGraf(graph, au);
                     }
 
+                    // Pakai indeks pola rute dari disk jika dibangun dari data yang sama
+                    muatIndeksPolaRute(indeksPola, namaFileIndeks, sidikJariGraf(graph, bacaKotaTerdaftar(namaFileKota)));
+
                     // Masuk ke menu utama
                     if (role == "user") {
                         // Tampilkan menu utama user
@@ -666,36 +3449,7 @@ int main() {
                             switch (pilihan) {
                                 case 1: {
                                     // Cari rute tercepat dan rekomendasi angkutan umum
-                                    cout << "\n-------Mau pergi ke mana?-------\n";
-                                    lihatDaftarKota(graph, namaFileKota);
-
-                                    int nomorAsal, nomorTujuan;
-                                    string asal, tujuan, waktu;
-
-                                    cout << "Pilih nomor kota asal: ";
-                                    cin >> nomorAsal;
-                                    asal = namaKotaDariNomor(graph, nomorAsal, namaFileKota);
-
-                                    cout << "Pilih nomor kota tujuan: ";
-                                    cin >> nomorTujuan;
-                                    tujuan = namaKotaDariNomor(graph, nomorTujuan, namaFileKota);
-
-                                    cout << "Pukul (HH:MM): ";
-                                    cin >> waktu;
-                                    cout << endl;
-
-                                    vector<string> ruteTercepat = cariRuteTercepat(graph, asal, tujuan, waktu);
-                                    if (ruteTercepat.empty()) {
-                                        cout << "Tidak ada angkutan umum yang beroperasi atau rute tidak ditemukan!\n";
-                                    } else {
-                                        vector<string> ruteAlternatif = cariRuteAlternatif(graph, asal, tujuan, waktu);
-
-                                        cout << "Rute tercepat:\n";
-                                        tampilkanRuteDanRekomendasi(ruteTercepat, angkutanUmum, waktu);
-
-                                        cout << "\nRute Alternatif:\n";
-                                        tampilkanRuteDanRekomendasi(ruteAlternatif, angkutanUmum, waktu);
-                                    }
+                                    tampilkanPencarianRute(graph, cacheRute, indeksPola, namaFileKota, "");
                                     break;
                                 }
                                 case 2: {
@@ -718,6 +3472,11 @@ int main() {
                                     lihatDaftarKota(graph, namaFileKota);
                                     break;
                                 }
+                                case 6: {
+                                    // Cari kota terjangkau dalam batas waktu
+                                    tampilkanKotaTerjangkau(graph, graphKompak, namaFileKota);
+                                    break;
+                                }
                                 case 99: {
                                     // Logout
                                     // Implementasi logout (kembali ke menu sebelumnya)
@@ -748,36 +3507,7 @@ int main() {
                             switch (pilihan) {
                                 case 1: {
                                     // Cari rute tercepat dan rekomendasi angkutan umum
-                                    cout << "\n-------Mau pergi ke mana?-------\n";
-                                    lihatDaftarKota(graph, namaFileKota);
-
-                                    int nomorAsal, nomorTujuan;
-                                    string asal, tujuan, waktu;
-
-                                    cout << "Pilih nomor kota asal: ";
-                                    cin >> nomorAsal;
-                                    asal = namaKotaDariNomor(graph, nomorAsal, namaFileKota);
-
-                                    cout << "Pilih nomor kota tujuan: ";
-                                    cin >> nomorTujuan;
-                                    tujuan = namaKotaDariNomor(graph, nomorTujuan, namaFileKota);
-
-                                    cout << "Pukul (HH:MM): ";
-                                    cin >> waktu;
-                                    cout << endl;
-
-                                    vector<string> ruteTercepat = cariRuteTercepat(graph, asal, tujuan, waktu);
-                                    if (ruteTercepat.empty()) {
-                                        cout << "[!INVALID!]: Tidak ada angkutan umum yang beroperasi atau rute tidak ditemukan!\n";
-                                    } else {
-                                        vector<string> ruteAlternatif = cariRuteAlternatif(graph, asal, tujuan, waktu);
-
-                                        cout << "Rute tercepat:\n";
-                                        tampilkanRuteDanRekomendasi(ruteTercepat, angkutanUmum, waktu);
-
-                                        cout << "\nRute Alternatif:\n";
-                                        tampilkanRuteDanRekomendasi(ruteAlternatif, angkutanUmum, waktu);
-                                    }
+                                    tampilkanPencarianRute(graph, cacheRute, indeksPola, namaFileKota, "[!INVALID!]: ");
                                     break;
                                 }
 
@@ -789,11 +3519,19 @@ int main() {
                                 case 3: {
                                     // Tambah jadwal angkutan umum
                                     tambahJadwalAngkutanUmum(angkutanUmum, graph, namaFile, namaFileKota);
+                                    cacheRute.pohon.clear(); // Struktur graf berubah, pohon rute lama tidak berlaku
+                                    indeksPola.kedaluwarsa = true;
+                                    storeGraf.kedaluwarsa = true;
+                                    graphKompak.kedaluwarsa = true;
                                     break;
                                 }
                                 case 4: {
                                     // Hapus jadwal angkutan umum
                                     hapusJadwalAngkutanUmum(angkutanUmum, graph, namaFile);
+                                    cacheRute.pohon.clear(); // Struktur graf berubah, pohon rute lama tidak berlaku
+                                    indeksPola.kedaluwarsa = true;
+                                    storeGraf.kedaluwarsa = true;
+                                    graphKompak.kedaluwarsa = true;
                                     break;
                                 }
                                 case 5: {
@@ -804,11 +3542,16 @@ int main() {
                                     cin.ignore(); // Membersihkan newline character dari input sebelumnya
                                     getline(cin, namaKota);// Menerima input kota dengan spasi
                                     tambahKota(graph, namaKota, angkutanUmum, namaFileKota);
+                                    cacheRute.pohon.clear(); // Struktur graf berubah, pohon rute lama tidak berlaku
+                                    indeksPola.kedaluwarsa = true;
+                                    storeGraf.kedaluwarsa = true;
+                                    graphKompak.kedaluwarsa = true;
                                     break;
                                 }
                                 case 6: {
                                     // Hapus kota
                                     hapusKota(graph, angkutanUmum, namaFileKota, namaFile);
+                                    indeksPola.kedaluwarsa = true; // Daftar kota terdaftar berubah
                                     break;
                                 }
                                 case 7: {
@@ -826,6 +3569,34 @@ int main() {
                                     lihatDaftarKota(graph, namaFileKota);
                                     break;
                                 }
+                                case 10: {
+                                    // Cari kota terjangkau dalam batas waktu
+                                    tampilkanKotaTerjangkau(graph, graphKompak, namaFileKota);
+                                    break;
+                                }
+                                case 11: {
+                                    // Cari rute tercepat dari graf berhalaman (disk)
+                                    tampilkanRuteBerhalaman(graph, storeGraf, namaFileKota, namaFileGraf);
+                                    break;
+                                }
+                                case 12: {
+                                    // Proses feed gangguan layanan (file/pipe)
+                                    tampilkanFeedGangguan(graph, cacheRute);
+                                    indeksPola.kedaluwarsa = true; // Overlay gangguan mengubah bobot edge
+                                    storeGraf.kedaluwarsa = true;
+                                    graphKompak.kedaluwarsa = true;
+                                    break;
+                                }
+                                case 13: {
+                                    // Cari rute tercepat dengan graf terpartisi (shard)
+                                    tampilkanRuteTerpartisi(graph, namaFileKota);
+                                    break;
+                                }
+                                case 14: {
+                                    // Bangun indeks pola rute antar kota terdaftar
+                                    tampilkanIndeksPolaRute(graph, indeksPola, namaFileKota, namaFileIndeks);
+                                    break;
+                                }
                                 case 99: {
                                     // Logout
                                     // Implementasi logout (kembali ke menu sebelumnya)
@@ -868,4 +3639,5 @@ int main() {
     } while (true);
 
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,671 @@
+// Benchmark untuk fungsi-fungsi routing di PROJEKAN_fixx.cpp.
+// Kompilasi: g++ -O2 -std=c++17 -pthread benchmark_rute.cpp -o benchmark_rute
+// Jumlah cache miss dapat dilihat dengan: perf stat -e cache-misses,cache-references ./benchmark_rute
+#define PROJEKAN_TANPA_MAIN
+#include "PROJEKAN_fixx.cpp"
+
+#include <chrono>
+#include <functional>
+#include <random>
+
+// Fungsi untuk membuat jaringan sintetis berbentuk grid (mirip jaringan jalan) dengan nama kota acak,
+// sehingga urutan abjad std::map tidak berhubungan dengan letak kota
+Graph buatGraphGrid(int lebar, int tinggi, unsigned seed) {
+    mt19937 rng(seed);
+    vector<int> acak(lebar * tinggi);
+    for (size_t i = 0; i < acak.size(); ++i) acak[i] = static_cast<int>(i);
+    shuffle(acak.begin(), acak.end(), rng);
+
+    auto nama = [&](int x, int y) { return "Kota" + to_string(acak[y * lebar + x]); };
+
+    Graph graph;
+    for (int y = 0; y < tinggi; ++y) {
+        for (int x = 0; x < lebar; ++x) {
+            graph.adjList[nama(x, y)];
+        }
+    }
+
+    const int dx[] = {1, -1, 0, 0};
+    const int dy[] = {0, 0, 1, -1};
+    for (int y = 0; y < tinggi; ++y) {
+        for (int x = 0; x < lebar; ++x) {
+            for (int arah = 0; arah < 4; ++arah) {
+                int nx = x + dx[arah], ny = y + dy[arah];
+                if (nx < 0 || ny < 0 || nx >= lebar || ny >= tinggi) continue;
+                AngkutanUmum au;
+                au.nama = rng() % 2 ? "Bus" : "Angkot";
+                au.kotaAsal = nama(x, y);
+                au.kotaTujuan = nama(nx, ny);
+                au.jamMulaiOperasional = "05:00";
+                au.jamTutupOperasional = "23:00";
+                au.waktuTempuh = 1 + rng() % 20;
+                tambahAngkutanUmumKeGraf(graph, au);
+            }
+        }
+    }
+    return graph;
+}
+
+// Fungsi untuk menghitung rata-rata selisih ID antara kota asal dan tujuan setiap edge (semakin kecil semakin lokal)
+double rataRataSelisihID(const GraphKompak &graph) {
+    double total = 0;
+    for (size_t u = 0; u + 1 < graph.offset.size(); ++u) {
+        for (int i = graph.offset[u]; i < graph.offset[u + 1]; ++i) {
+            total += abs(graph.tujuan[i] - static_cast<int>(u));
+        }
+    }
+    return graph.tujuan.empty() ? 0.0 : total / graph.tujuan.size();
+}
+
+// Fungsi untuk mengukur rata-rata latensi cariRuteTercepatKompak (mikrodetik per query)
+double ukurLatensiKompak(const GraphKompak &graph, const vector<pair<string, string>> &query, size_t &jumlahDitemukan) {
+    jumlahDitemukan = 0;
+    auto mulai = chrono::steady_clock::now();
+    for (const auto &q : query) {
+        if (!cariRuteTercepatKompak(graph, q.first, q.second, "07:00").empty()) {
+            jumlahDitemukan++;
+        }
+    }
+    auto selesai = chrono::steady_clock::now();
+    return chrono::duration<double, micro>(selesai - mulai).count() / query.size();
+}
+
+// Benchmark urutan node: urutan abjad std::map dibandingkan dengan Reverse Cuthill-McKee
+void benchmarkUrutanNode() {
+    cout << "=== Benchmark urutan node (grid 250 x 250) ===\n";
+    Graph graph = buatGraphGrid(250, 250, 42);
+
+    mt19937 rng(7);
+    vector<string> semuaKota = urutanKotaAbjad(graph);
+    vector<pair<string, string>> query;
+    for (int i = 0; i < 200; ++i) {
+        query.push_back({semuaKota[rng() % semuaKota.size()], semuaKota[rng() % semuaKota.size()]});
+    }
+
+    auto mulai = chrono::steady_clock::now();
+    vector<string> urutanRCM = urutanKotaCuthillMcKee(graph);
+    double waktuUrut = chrono::duration<double, milli>(chrono::steady_clock::now() - mulai).count();
+
+    GraphKompak abjad = bangunGraphKompak(graph, urutanKotaAbjad(graph));
+    GraphKompak rcm = bangunGraphKompak(graph, urutanRCM);
+
+    size_t ditemukanAbjad, ditemukanRCM;
+    double latensiAbjad = ukurLatensiKompak(abjad, query, ditemukanAbjad);
+    double latensiRCM = ukurLatensiKompak(rcm, query, ditemukanRCM);
+
+    cout << "Waktu praproses Cuthill-McKee: " << waktuUrut << " ms\n";
+    cout << "Urutan abjad  : selisih ID rata-rata " << rataRataSelisihID(abjad) << ", latensi " << latensiAbjad
+         << " us/query (" << ditemukanAbjad << " rute)\n";
+    cout << "Cuthill-McKee : selisih ID rata-rata " << rataRataSelisihID(rcm) << ", latensi " << latensiRCM
+         << " us/query (" << ditemukanRCM << " rute)\n\n";
+}
+
+// Fungsi untuk membuat graf kompak berbentuk bintang: kota 0 (hub) memiliki `derajat` edge keluar
+GraphKompak buatGraphBintang(int derajat, mt19937 &rng) {
+    GraphKompak graph;
+    for (int i = 0; i <= derajat; ++i) {
+        graph.namaKota.push_back("Kota" + to_string(i));
+        graph.idKota[graph.namaKota.back()] = i;
+        graph.offset.push_back(i == 0 ? 0 : derajat);
+    }
+    graph.offset.push_back(derajat);
+    graph.namaAngkutan.push_back("Bus");
+
+    for (int i = 0; i < derajat; ++i) {
+        EdgeKompak edge;
+        edge.tujuan = 1 + i;
+        edge.waktuTempuh = 1 + rng() % 120;
+        edge.mulai = rng() % 720;
+        edge.tutup = edge.mulai + rng() % 720;
+        edge.frekuensi = rng() % 2 ? 0 : 5 + rng() % 30;
+        edge.hariMask = rng() % 4 ? 0x7F : 0x1F;
+        edge.angkutan = 0;
+        tambahEdgeKompak(graph, edge);
+    }
+    return graph;
+}
+
+// Fungsi untuk mengukur waktu kernel relaksasi (nanodetik per edge) pada hub berderajat tertentu
+double ukurKernel(KernelRelaksasi kernel, const GraphKompak &graph, const vector<vector<int>> &daftarDist, int ulangan, long &totalBaik) {
+    int derajat = graph.offset[1];
+    vector<int> idxBaik(derajat), jarakBaik(derajat);
+    totalBaik = 0;
+    auto mulai = chrono::steady_clock::now();
+    for (int r = 0; r < ulangan; ++r) {
+        const vector<int> &dist = daftarDist[r % daftarDist.size()];
+        int menit = 300 + (r * 37) % 900;
+        totalBaik += kernel(graph, 0, derajat, 100, menit, r % 8, dist.data(), idxBaik.data(), jarakBaik.data());
+    }
+    auto selesai = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(selesai - mulai).count() / (static_cast<double>(ulangan) * derajat);
+}
+
+// Benchmark kernel relaksasi edge per kelompok derajat kota (skalar dibandingkan dengan AVX2)
+void benchmarkKernelRelaksasi() {
+    cout << "=== Benchmark kernel relaksasi per derajat kota ===\n";
+    cout << "Kernel yang dipakai: " << (kernelRelaksasi == relaksasiEdgeSkalar ? "skalar" : "AVX2") << "\n";
+
+    mt19937 rng(11);
+    const int daftarDerajat[] = {4, 8, 16, 32, 64, 256, 1024};
+    for (int derajat : daftarDerajat) {
+        GraphKompak graph = buatGraphBintang(derajat, rng);
+
+        // Beberapa larik dist berbeda agar hasil perbandingan tidak selalu sama
+        vector<vector<int>> daftarDist(16, vector<int>(derajat + 1));
+        for (auto &dist : daftarDist) {
+            for (auto &d : dist) {
+                d = rng() % 4 ? static_cast<int>(rng() % 400) : numeric_limits<int>::max();
+            }
+        }
+
+        int ulangan = max(1, 4000000 / derajat);
+        long baikSkalar = 0, baikAVX2 = 0;
+        double nsSkalar = ukurKernel(relaksasiEdgeSkalar, graph, daftarDist, ulangan, baikSkalar);
+        cout << "Derajat " << derajat << ": skalar " << nsSkalar << " ns/edge";
+#ifdef PROJEKAN_AVX2
+        if (__builtin_cpu_supports("avx2")) {
+            double nsAVX2 = ukurKernel(relaksasiEdgeAVX2, graph, daftarDist, ulangan, baikAVX2);
+            cout << ", AVX2 " << nsAVX2 << " ns/edge (" << nsSkalar / nsAVX2 << "x)"
+                 << (baikSkalar == baikAVX2 ? "" : " [HASIL BERBEDA!]");
+        }
+#endif
+        cout << "\n";
+    }
+    cout << "\n";
+}
+
+// Benchmark feed gangguan: latensi penerapan event + perbaikan pohon dibandingkan hitung ulang penuh,
+// serta dampak overlay gangguan terhadap latensi query
+void benchmarkFeedGangguan() {
+    cout << "=== Benchmark feed gangguan (grid 60 x 60, 20 pohon di cache) ===\n";
+    Graph graph = buatGraphGrid(60, 60, 5);
+    vector<string> semuaKota = urutanKotaAbjad(graph);
+    mt19937 rng(13);
+
+    vector<pair<string, string>> query;
+    for (int i = 0; i < 50; ++i) {
+        query.push_back({semuaKota[rng() % semuaKota.size()], semuaKota[rng() % semuaKota.size()]});
+    }
+    auto ukurQuery = [&]() {
+        auto mulai = chrono::steady_clock::now();
+        for (const auto &q : query) {
+            cariRuteTercepat(graph, q.first, q.second, "07:00");
+        }
+        return chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / query.size();
+    };
+    double latensiTanpaOverlay = ukurQuery();
+
+    CacheRute cache;
+    vector<string> asalPohon;
+    for (int i = 0; i < 20; ++i) {
+        asalPohon.push_back(semuaKota[rng() % semuaKota.size()]);
+        cariRuteTercepatTersimpan(cache, graph, asalPohon.back(), semuaKota[0], "07:00");
+    }
+
+    // Feed sintetis: keterlambatan, pembatalan, dan pemulihan pada layanan acak
+    const int JUMLAH_EVENT = 2000, UKURAN_BATCH = 100;
+    vector<string> baris;
+    const char *jenis[] = {"TERLAMBAT", "BATAL", "PULIH"};
+    for (int i = 0; i < JUMLAH_EVENT; ++i) {
+        const auto &daftar = graph.adjList.at(semuaKota[rng() % semuaKota.size()]);
+        const AngkutanUmum &au = daftar[rng() % daftar.size()].second;
+        int j = rng() % 3;
+        baris.push_back(string(jenis[j]) + " " + au.nama + " " + au.kotaAsal + " " + au.kotaTujuan + " " + au.jamMulaiOperasional +
+                        (j == 0 ? " " + to_string(1 + rng() % 30) : ""));
+    }
+
+    // Feed datang per batch; setelah setiap batch semua pohon dipakai sekali sehingga diperbaiki saat lookup
+    StatistikFeed statistik;
+    double lookupMikrodetik = 0;
+    long jumlahLookup = 0;
+    for (int i = 0; i < JUMLAH_EVENT; i += UKURAN_BATCH) {
+        stringstream feed;
+        for (int k = i; k < min(JUMLAH_EVENT, i + UKURAN_BATCH); ++k) feed << baris[k] << "\n";
+        StatistikFeed batch = prosesFeedGangguan(graph, cache, feed);
+        statistik.diterapkan += batch.diterapkan;
+        statistik.totalMikrodetik += batch.totalMikrodetik;
+
+        auto mulai = chrono::steady_clock::now();
+        for (const auto &asal : asalPohon) {
+            cariRuteTercepatTersimpan(cache, graph, asal, semuaKota[0], "07:00");
+            jumlahLookup++;
+        }
+        lookupMikrodetik += chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count();
+    }
+
+    int pohonBerbeda = 0;
+    auto mulai = chrono::steady_clock::now();
+    for (const auto &entry : cache.pohon) {
+        PohonRute baru = bangunPohonRute(graph, entry.second.asal, entry.second.waktu, entry.second.hari);
+        pohonBerbeda += baru.dist != entry.second.dist;
+    }
+    double hitungUlang = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / cache.pohon.size();
+    double latensiDenganOverlay = ukurQuery();
+    int jumlahTerlambat, jumlahBatal;
+    hitungOverlayGangguan(graph, jumlahTerlambat, jumlahBatal);
+
+    cout << "Event diterapkan: " << statistik.diterapkan << ", " << statistik.totalMikrodetik / statistik.diterapkan
+         << " us/event (" << 1e6 * statistik.diterapkan / statistik.totalMikrodetik << " event/detik, perbaikan ditunda)\n";
+    cout << "Lookup setelah setiap " << UKURAN_BATCH << " event: " << lookupMikrodetik / jumlahLookup
+         << " us/pohon (perbaikan gabungan) vs hitung ulang penuh " << hitungUlang << " us/pohon"
+         << (pohonBerbeda == 0 ? "" : " [" + to_string(pohonBerbeda) + " POHON BERBEDA]") << "\n";
+    cout << "Throughput termasuk perbaikan " << asalPohon.size() << " pohon per batch: "
+         << 1e6 * statistik.diterapkan / (statistik.totalMikrodetik + lookupMikrodetik) << " event/detik\n";
+    cout << "Latensi query: tanpa overlay " << latensiTanpaOverlay << " us, dengan " << jumlahTerlambat
+         << " keterlambatan + " << jumlahBatal << " pembatalan " << latensiDenganOverlay << " us\n\n";
+}
+
+// Fungsi untuk menghitung lama perjalanan sebuah rute (menit) dengan memilih angkutan tercepat di setiap ruas,
+// -1 jika rute kosong. Rute dengan lama yang sama dianggap setara walaupun urutan kotanya berbeda.
+int lamaPerjalananRute(const Graph &graph, const vector<string> &rute, const string &waktu, int hari = 0) {
+    if (rute.empty()) return -1;
+    int menit = waktuKeMenit(waktu);
+    for (size_t i = 0; i + 1 < rute.size(); ++i) {
+        menit += bobotTerbaikAntarKota(graph, rute[i], rute[i + 1], menit, hari);
+    }
+    return menit - waktuKeMenit(waktu);
+}
+
+// Benchmark penyimpanan graf berhalaman: membangun file dari Graph dibandingkan pemuat yang membaca file data
+// langsung, lalu latensi query dengan store yang dibuka ulang tiap query dibandingkan store yang tetap terbuka
+void benchmarkPenyimpananBerhalaman() {
+    const int JUMLAH_FRAME = 1024;
+    cout << "=== Benchmark graf berhalaman (grid 150 x 150, " << JUMLAH_FRAME << " frame) ===\n";
+    Graph graph = buatGraphGrid(150, 150, 29);
+    vector<AngkutanUmum> daftar;
+    for (const auto &entry : graph.adjList) {
+        for (const auto &neighbor : entry.second) daftar.push_back(neighbor.second);
+    }
+    const string namaFileData = "benchmark_data_angkutan.txt", namaFileKota = "benchmark_kota_kosong.txt";
+    const string namaFileGraf = "benchmark_graf_berhalaman.bin";
+    tulisDataAngkutanUmum(daftar, namaFileData);
+    ofstream(namaFileKota).close();
+
+    // Jalur menu: file data dibaca menjadi Graph, lalu Graph ditulis ke halaman
+    auto mulai = chrono::steady_clock::now();
+    {
+        Graph dariData;
+        bacaDaftarKota(dariData, namaFileKota);
+        for (const auto &au : bacaDataAngkutanUmum(namaFileData)) tambahAngkutanUmumKeGraf(dariData, au);
+        bangunPenyimpananGraf(dariData, namaFileGraf);
+    }
+    double dariGraph = chrono::duration<double, milli>(chrono::steady_clock::now() - mulai).count();
+    mulai = chrono::steady_clock::now();
+    bangunPenyimpananGrafDariFile(namaFileData, namaFileKota, namaFileGraf);
+    double dariFile = chrono::duration<double, milli>(chrono::steady_clock::now() - mulai).count();
+
+    vector<string> semuaKota = urutanKotaAbjad(graph);
+    mt19937 rng(31);
+    vector<pair<string, string>> query;
+    for (int i = 0; i < 50; ++i) {
+        query.push_back({semuaKota[rng() % semuaKota.size()], semuaKota[rng() % semuaKota.size()]});
+    }
+
+    // Store baru per query (buffer pool dingin) dibandingkan satu store untuk semua query.
+    // Halaman yang dibaca dari disk = page fault + prefetch
+    long bacaDingin = 0, bacaHangat = 0;
+    size_t berbeda = 0;
+    mulai = chrono::steady_clock::now();
+    for (const auto &q : query) {
+        PenyimpananGrafBerhalaman store;
+        bukaPenyimpananGraf(store, namaFileGraf, JUMLAH_FRAME);
+        cariRuteTercepatBerhalaman(store, q.first, q.second, "07:00");
+        bacaDingin += store.statistik.pageFault + store.statistik.prefetch;
+    }
+    double latensiDingin = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / query.size();
+
+    PenyimpananGrafBerhalaman store;
+    siapkanPenyimpananGraf(store, graph, namaFileGraf, JUMLAH_FRAME);
+    mulai = chrono::steady_clock::now();
+    for (const auto &q : query) {
+        siapkanPenyimpananGraf(store, graph, namaFileGraf, JUMLAH_FRAME);
+        cariRuteTercepatBerhalaman(store, q.first, q.second, "07:00");
+        bacaHangat += store.statistik.pageFault + store.statistik.prefetch;
+    }
+    double latensiHangat = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / query.size();
+    for (const auto &q : query) {
+        if (lamaPerjalananRute(graph, cariRuteTercepatBerhalaman(store, q.first, q.second, "07:00"), "07:00") !=
+            lamaPerjalananRute(graph, cariRuteTercepat(graph, q.first, q.second, "07:00"), "07:00")) {
+            berbeda++;
+        }
+    }
+    remove(namaFileData.c_str());
+    remove(namaFileKota.c_str());
+    remove(namaFileGraf.c_str());
+
+    cout << "Bangun file: baca ke Graph lalu tulis " << dariGraph << " ms, langsung dari file data (tanpa Graph) " << dariFile << " ms\n";
+    cout << "Store dibuka ulang per query: " << latensiDingin << " us/query, " << bacaDingin / query.size()
+         << " halaman dibaca dari disk/query\n";
+    cout << "Store tetap terbuka: " << latensiHangat << " us/query, " << bacaHangat / query.size() << " halaman dibaca dari disk/query"
+         << (berbeda == 0 ? "" : " [" + to_string(berbeda) + " HASIL BERBEDA]") << "\n\n";
+}
+
+#ifdef PROJEKAN_THREAD
+// Fungsi pembanding: kota terjangkau dari banyak asal dengan thread baru di setiap panggilan (tanpa kumpulan thread)
+vector<vector<pair<string, int>>> cariKotaTerjangkauThreadBaru(const GraphKompak &graph, const vector<string> &daftarAsal,
+                                                              const string &waktu, int batasMenit) {
+    vector<vector<pair<string, int>>> hasil(daftarAsal.size());
+    size_t jumlahThread = min<size_t>(max(1u, thread::hardware_concurrency()), max<size_t>(daftarAsal.size(), 1));
+    vector<thread> pekerja;
+    for (size_t t = 0; t < jumlahThread; ++t) {
+        pekerja.emplace_back([&, t]() {
+            for (size_t i = t; i < daftarAsal.size(); i += jumlahThread) {
+                hasil[i] = cariKotaTerjangkauKompak(graph, daftarAsal[i], waktu, batasMenit);
+            }
+        });
+    }
+    for (auto &p : pekerja) {
+        p.join();
+    }
+    return hasil;
+}
+#endif
+
+// Benchmark isochrone banyak asal: throughput (asal per detik) berurutan pada graf map dan graf kompak, lalu paralel
+// pada graf kompak dengan thread baru per panggilan dan dengan kumpulan thread bersama. Panggilan dibuat dalam batch
+// kecil seperti permintaan dari menu.
+void benchmarkIsochroneBanyakAsal() {
+    const int JUMLAH_ASAL = 512, UKURAN_BATCH = 8;
+    cout << "=== Benchmark isochrone banyak asal (grid 60 x 60, " << JUMLAH_ASAL << " asal, batch " << UKURAN_BATCH
+         << ", batas 60 menit, " << jumlahThreadParalel() << " thread) ===\n";
+    Graph graph = buatGraphGrid(60, 60, 17);
+    GraphKompak kompak = bangunGraphKompak(graph, urutanKotaCuthillMcKee(graph));
+    vector<string> semuaKota = urutanKotaAbjad(graph);
+    mt19937 rng(23);
+    vector<string> daftarAsal;
+    for (int i = 0; i < JUMLAH_ASAL; ++i) {
+        daftarAsal.push_back(semuaKota[rng() % semuaKota.size()]);
+    }
+
+    size_t jumlahKota = 0;
+    auto ukur = [&](const function<vector<vector<pair<string, int>>>(const vector<string> &)> &cari) {
+        jumlahKota = 0;
+        auto mulai = chrono::steady_clock::now();
+        for (size_t i = 0; i < daftarAsal.size(); i += UKURAN_BATCH) {
+            vector<string> batch(daftarAsal.begin() + i, daftarAsal.begin() + min(daftarAsal.size(), i + UKURAN_BATCH));
+            for (const auto &hasil : cari(batch)) jumlahKota += hasil.size();
+        }
+        double detik = chrono::duration<double>(chrono::steady_clock::now() - mulai).count();
+        return daftarAsal.size() / detik;
+    };
+
+    double berurutan = ukur([&](const vector<string> &batch) {
+        vector<vector<pair<string, int>>> hasil;
+        for (const auto &asal : batch) hasil.push_back(cariKotaTerjangkau(graph, asal, "07:00", 60));
+        return hasil;
+    });
+    size_t kotaBerurutan = jumlahKota;
+    double berurutanKompak = ukur([&](const vector<string> &batch) {
+        vector<vector<pair<string, int>>> hasil;
+        for (const auto &asal : batch) hasil.push_back(cariKotaTerjangkauKompak(kompak, asal, "07:00", 60));
+        return hasil;
+    });
+    size_t berbeda = jumlahKota != kotaBerurutan;
+#ifdef PROJEKAN_THREAD
+    double threadBaru = ukur([&](const vector<string> &batch) { return cariKotaTerjangkauThreadBaru(kompak, batch, "07:00", 60); });
+    berbeda += jumlahKota != kotaBerurutan;
+#endif
+    double kumpulan = ukur([&](const vector<string> &batch) { return cariKotaTerjangkauBanyak(kompak, batch, "07:00", 60); });
+    berbeda += jumlahKota != kotaBerurutan;
+
+    cout << "Berurutan, graf map: " << berurutan << " asal/detik (rata-rata " << kotaBerurutan / daftarAsal.size()
+         << " kota terjangkau)\n";
+    cout << "Berurutan, graf kompak: " << berurutanKompak << " asal/detik\n";
+#ifdef PROJEKAN_THREAD
+    cout << "Thread baru per panggilan, graf kompak: " << threadBaru << " asal/detik\n";
+#endif
+    cout << "Kumpulan thread bersama, graf kompak: " << kumpulan << " asal/detik" << (berbeda == 0 ? "" : " [HASIL BERBEDA]")
+         << "\n\n";
+}
+
+// Benchmark routing terpartisi: latensi koordinator + shard (proses terpisah, socket lokal) dibandingkan
+// graf utuh dalam satu proses, serta memori graf terbesar per shard
+void benchmarkShard() {
+#ifdef PROJEKAN_SHARD
+    cout << "=== Benchmark routing terpartisi (grid 80 x 80, 100 query) ===\n";
+    Graph graph = buatGraphGrid(80, 80, 17);
+    vector<string> semuaKota = urutanKotaAbjad(graph);
+    mt19937 rng(23);
+    vector<pair<string, string>> query;
+    for (int i = 0; i < 100; ++i) {
+        query.push_back({semuaKota[rng() % semuaKota.size()], semuaKota[rng() % semuaKota.size()]});
+    }
+
+    vector<vector<string>> ruteUtuh(query.size());
+    auto mulai = chrono::steady_clock::now();
+    for (size_t i = 0; i < query.size(); ++i) {
+        ruteUtuh[i] = cariRuteTercepat(graph, query[i].first, query[i].second, "07:00");
+    }
+    double latensiUtuh = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / query.size();
+    cout << "Graf utuh: " << latensiUtuh << " us/query, +/- " << perkiraanMemoriGraf(graph) / 1024 << " KB\n";
+
+    for (int jumlahRegion : {2, 4, 8, 16}) {
+        KoordinatorShard koordinator;
+        if (!mulaiShard(koordinator, graph, jumlahRegion)) break;
+
+        koordinator.pesanTerkirim = 0;
+        vector<vector<string>> ruteShard(query.size());
+        mulai = chrono::steady_clock::now();
+        for (size_t i = 0; i < query.size(); ++i) {
+            ruteShard[i] = cariRuteTercepatTerpartisi(koordinator, query[i].first, query[i].second, "07:00");
+        }
+        double latensiShard = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / query.size();
+        long pesanQuery = koordinator.pesanTerkirim;
+
+        // Rute bisa berbeda jika ada beberapa rute sama cepat, sehingga yang dibandingkan adalah lama perjalanannya
+        size_t berbeda = 0;
+        for (size_t i = 0; i < query.size(); ++i) {
+            if (lamaPerjalananRute(graph, ruteShard[i], "07:00") != lamaPerjalananRute(graph, ruteUtuh[i], "07:00")) berbeda++;
+        }
+
+        long grafTerbesar = 0, statusTerbesar = 0;
+        vector<string> balasan;
+        for (size_t id = 0; id < koordinator.shard.size(); ++id) {
+            if (!kirimPerintahShard(koordinator, id, "MEMORI", balasan) || balasan.empty()) continue;
+            long jumlahKota, jumlahEdge, byteGraf, byteStatus;
+            stringstream(balasan[0]) >> jumlahKota >> jumlahEdge >> byteGraf >> byteStatus;
+            grafTerbesar = max(grafTerbesar, byteGraf);
+            statusTerbesar = max(statusTerbesar, byteStatus);
+        }
+        cout << jumlahRegion << " shard: " << hitungEdgePotong(graph, koordinator.region) << " edge potong, " << latensiShard
+             << " us/query (" << static_cast<double>(pesanQuery) / query.size() << " round trip), shard terbesar +/- "
+             << grafTerbesar / 1024 << " KB graf + " << statusTerbesar / 1024 << " KB status pencarian"
+             << (berbeda == 0 ? "" : " [" + to_string(berbeda) + " HASIL BERBEDA]") << "\n";
+        hentikanShard(koordinator);
+    }
+    cout << "\n";
+#endif
+}
+
+// Kernel Dijkstra tulisan tangan (tanpa kebijakan) sebagai pembanding inti pencarian berbasis template.
+// Jika tujuan tidak kosong, pencarian berhenti begitu kota tujuan akan diekspansi.
+void dijkstraTulisTangan(const Graph &graph, int menitBerangkat, int hari, const string &tujuan, map<string, int> &dist,
+                         map<string, string> &prev, AntrianDijkstra &pq) {
+    while (!pq.empty()) {
+        int jarak = pq.top().first;
+        string current = pq.top().second;
+        pq.pop();
+        if (jarak > dist[current]) continue;
+        if (current == tujuan) break;
+        int menit = menitBerangkat + jarak;
+        for (const auto &neighbor : graph.adjList.at(current)) {
+            const AngkutanUmum &au = neighbor.second;
+            if (au.dibatalkan || !isAngkutanUmumAvailable(au, menit, hari)) continue;
+            int weight = waktuTungguAngkutanUmum(au, menit) + au.waktuTempuh + au.keterlambatan;
+            if (jarak + weight < dist[neighbor.first]) {
+                dist[neighbor.first] = jarak + weight;
+                prev[neighbor.first] = current;
+                pq.push({dist[neighbor.first], neighbor.first});
+            }
+        }
+    }
+}
+
+// Benchmark inti pencarian berbasis kebijakan: kernel tulisan tangan vs template vs kebijakan yang dipilih saat runtime
+// (std::function), untuk pohon lengkap dan pencarian yang berhenti di tujuan
+void benchmarkKebijakanPencarian() {
+    cout << "=== Benchmark inti pencarian berbasis kebijakan (grid 40 x 40, 100 query, terbaik dari 5 putaran) ===\n";
+    Graph graph = buatGraphGrid(40, 40, 29);
+    vector<string> semuaKota = urutanKotaAbjad(graph);
+    mt19937 rng(31);
+    vector<pair<string, string>> query;
+    for (int i = 0; i < 100; ++i) {
+        query.push_back({semuaKota[rng() % semuaKota.size()], semuaKota[rng() % semuaKota.size()]});
+    }
+    const int menit = waktuKeMenit("07:00");
+    const int hari = 0;
+
+    // Menjalankan satu varian untuk semua query dan mengembalikan rata-rata mikrodetik per query serta checksum jarak
+    auto ukurSekali = [&](auto jalankan, long &checksum) {
+        checksum = 0;
+        auto mulai = chrono::steady_clock::now();
+        for (const auto &q : query) {
+            map<string, int> dist;
+            map<string, string> prev;
+            AntrianDijkstra pq;
+            mulaiPencarian(graph, q.first, dist, prev, pq);
+            jalankan(q.second, dist, prev, pq);
+            if (dist[q.second] != numeric_limits<int>::max()) checksum += dist[q.second];
+        }
+        return chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / query.size();
+    };
+    // Waktu terbaik dari beberapa putaran agar gangguan dari proses lain tidak ikut terukur
+    auto ukur = [&](auto jalankan, long &checksum) {
+        double terbaik = numeric_limits<double>::max();
+        for (int putaran = 0; putaran < 5; ++putaran) {
+            terbaik = min(terbaik, ukurSekali(jalankan, checksum));
+        }
+        return terbaik;
+    };
+
+    // Biaya yang dipilih saat runtime; waktu tiba dan dipilih() diwarisi dari BiayaWaktuTempuh
+    struct BiayaRuntime : BiayaWaktuTempuh {
+        function<int(const string &, const AngkutanUmum &, int)> biaya;
+        int operator()(const string &dari, const AngkutanUmum &au, int menit) const { return biaya(dari, au, menit); }
+    };
+    function<bool(const string &, const string &, const AngkutanUmum &, int)> filterRuntime = FilterTersedia{hari};
+    BiayaRuntime biayaRuntime;
+    biayaRuntime.biaya = [](const string &dari, const AngkutanUmum &au, int menit) { return BiayaWaktuTempuh()(dari, au, menit); };
+    function<int(const string &)> heuristikRuntime = TanpaHeuristik();
+
+    for (bool keTujuan : {false, true}) {
+        long cekTangan, cekTemplate, cekRuntime;
+        double tangan = ukur([&](const string &tujuan, map<string, int> &dist, map<string, string> &prev, AntrianDijkstra &pq) {
+            dijkstraTulisTangan(graph, menit, hari, keTujuan ? tujuan : "", dist, prev, pq);
+        }, cekTangan);
+        double generik = ukur([&](const string &tujuan, map<string, int> &dist, map<string, string> &prev, AntrianDijkstra &pq) {
+            if (keTujuan) {
+                cariDenganKebijakan(AksesGraph{graph}, menit, dist, prev, pq, BiayaWaktuTempuh(), FilterTersedia{hari},
+                                    TanpaHeuristik(), HentiDiTujuan<string>{tujuan});
+            } else {
+                cariDenganKebijakan(AksesGraph{graph}, menit, dist, prev, pq, BiayaWaktuTempuh(), FilterTersedia{hari},
+                                    TanpaHeuristik(), HentiBatasWaktu{numeric_limits<int>::max()});
+            }
+        }, cekTemplate);
+        double runtime = ukur([&](const string &tujuan, map<string, int> &dist, map<string, string> &prev, AntrianDijkstra &pq) {
+            function<bool(const string &, int)> hentiRuntime = [&](const string &kota, int) { return keTujuan && kota == tujuan; };
+            cariDenganKebijakan(AksesGraph{graph}, menit, dist, prev, pq, biayaRuntime, filterRuntime, heuristikRuntime, hentiRuntime);
+        }, cekRuntime);
+
+        cout << (keTujuan ? "Berhenti di tujuan" : "Pohon lengkap     ") << ": tulisan tangan " << tangan << " us, template " << generik
+             << " us (" << 100.0 * generik / tangan << "%), std::function " << runtime << " us (" << 100.0 * runtime / tangan << "%)"
+             << (cekTangan == cekTemplate && cekTangan == cekRuntime ? "" : " [HASIL BERBEDA]") << "\n";
+    }
+
+    // Kebijakan yang biayanya bergantung pada edge sebelumnya: penalti per transit menukar lama perjalanan dengan
+    // jumlah pergantian layanan (penalti 0 = rute tercepat)
+    for (int penalti : {0, 15, 60}) {
+        long totalTransit = 0, totalMenit = 0;
+        int terjangkau = 0;
+        auto mulai = chrono::steady_clock::now();
+        for (const auto &q : query) {
+            map<string, int> dist;
+            map<string, string> prev;
+            map<string, pair<int, string>> tiba;
+            AntrianDijkstra pq;
+            mulaiPencarian(graph, q.first, dist, prev, pq);
+            cariDenganKebijakan(AksesGraph{graph}, menit, dist, prev, pq, BiayaTransitMinimum{penalti, tiba}, FilterTersedia{hari},
+                                TanpaHeuristik(), HentiDiTujuan<string>{q.second});
+
+            vector<string> rute = rekonstruksiRute(prev, q.second);
+            if (rute.empty()) continue;
+            terjangkau++;
+            totalMenit += tiba[q.second].first - menit;
+            for (size_t i = 2; i < rute.size(); ++i) {
+                if (tiba[rute[i]].second != tiba[rute[i - 1]].second) totalTransit++;
+            }
+        }
+        double us = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / query.size();
+        cout << "Penalti transit " << penalti << " menit: rata-rata " << static_cast<double>(totalTransit) / max(terjangkau, 1)
+             << " transit, " << static_cast<double>(totalMenit) / max(terjangkau, 1) << " menit perjalanan, " << us << " us/query\n";
+    }
+    cout << "\n";
+}
+
+// Benchmark indeks pola rute: waktu bangun, ukuran file, dan latensi query indeks dibandingkan pencarian langsung
+// (rute tercepat + alternatif) untuk semua pasangan kota terdaftar
+void benchmarkIndeksPolaRute() {
+    cout << "=== Benchmark indeks pola rute (grid 10 x 10, 8 kota terdaftar) ===\n";
+    Graph graph = buatGraphGrid(10, 10, 37);
+    vector<string> semuaKota = urutanKotaAbjad(graph);
+    mt19937 rng(41);
+    shuffle(semuaKota.begin(), semuaKota.end(), rng);
+    vector<string> kotaTerdaftar(semuaKota.begin(), semuaKota.begin() + 8);
+
+    auto mulai = chrono::steady_clock::now();
+    IndeksPolaRute indeks = bangunIndeksPolaRute(graph, kotaTerdaftar);
+    double lamaBangun = chrono::duration<double, milli>(chrono::steady_clock::now() - mulai).count();
+    const string namaFile = "benchmark_indeks_pola_rute.bin";
+    simpanIndeksPolaRute(indeks, namaFile);
+    ifstream file(namaFile, ios::binary | ios::ate);
+    long ukuranFile = static_cast<long>(file.tellg());
+    file.close();
+    IndeksPolaRute dimuat;
+    bool berhasilDimuat = muatIndeksPolaRute(dimuat, namaFile, sidikJariGraf(graph, kotaTerdaftar));
+    remove(namaFile.c_str());
+
+    vector<pair<string, string>> query;
+    vector<string> waktu;
+    for (int i = 0; i < 200; ++i) {
+        query.push_back({kotaTerdaftar[rng() % kotaTerdaftar.size()], kotaTerdaftar[rng() % kotaTerdaftar.size()]});
+        waktu.push_back(menitKeWaktu(300 + rng() % (18 * 60)));
+    }
+    vector<string> ruteTercepat, ruteAlternatif;
+    mulai = chrono::steady_clock::now();
+    for (size_t i = 0; i < query.size(); ++i) {
+        cariRuteTerindeks(dimuat, query[i].first, query[i].second, waktu[i], 0, ruteTercepat, ruteAlternatif);
+    }
+    double latensiIndeks = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / query.size();
+
+    // Hanya pencarian langsung yang diukur; hasilnya disimpan lalu dicocokkan dengan indeks di luar pengukuran
+    vector<vector<string>> tercepat(query.size()), alternatif(query.size());
+    mulai = chrono::steady_clock::now();
+    for (size_t i = 0; i < query.size(); ++i) {
+        tercepat[i] = cariRuteTercepat(graph, query[i].first, query[i].second, waktu[i]);
+        alternatif[i] = cariRuteAlternatifDari(graph, query[i].first, query[i].second, waktu[i], 0, tercepat[i]);
+    }
+    double latensiLangsung = chrono::duration<double, micro>(chrono::steady_clock::now() - mulai).count() / query.size();
+
+    int berbeda = 0;
+    for (size_t i = 0; i < query.size(); ++i) {
+        cariRuteTerindeks(dimuat, query[i].first, query[i].second, waktu[i], 0, ruteTercepat, ruteAlternatif);
+        if (tercepat[i] != ruteTercepat || alternatif[i] != ruteAlternatif) berbeda++;
+    }
+
+    cout << "Bangun: " << lamaBangun << " ms, " << indeks.pola.size() << " pola, file " << ukuranFile << " byte"
+         << (berhasilDimuat ? "" : " [GAGAL DIMUAT]") << "\n";
+    cout << "Query: indeks " << latensiIndeks << " us, pencarian langsung " << latensiLangsung << " us"
+         << (berbeda == 0 ? "" : " [" + to_string(berbeda) + " HASIL BERBEDA]") << "\n\n";
+}
+
+int main() {
+    benchmarkUrutanNode();
+    benchmarkKernelRelaksasi();
+    benchmarkFeedGangguan();
+    benchmarkPenyimpananBerhalaman();
+    benchmarkIsochroneBanyakAsal();
+    benchmarkShard();
+    benchmarkKebijakanPencarian();
+    benchmarkIndeksPolaRute();
+    return 0;
+}